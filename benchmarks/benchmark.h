@@ -0,0 +1,197 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2019 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "kahypar/definitions.h"
+
+namespace kahypar {
+namespace benchmark {
+enum class DegreeDistribution : uint8_t {
+  uniform,
+  power_law
+};
+
+static std::ostream& operator<< (std::ostream& os, const DegreeDistribution& distribution) {
+  switch (distribution) {
+    case DegreeDistribution::uniform: return os << "uniform";
+    case DegreeDistribution::power_law: return os << "power_law";
+      // omit default case to trigger compiler warning for missing cases
+  }
+  return os << static_cast<uint8_t>(distribution);
+}
+
+struct Parameters {
+  // number of hypernodes and hyperedges of the synthetic hypergraph and
+  // number of elements of all other workloads
+  size_t size = 100000;
+  PartitionID k = 32;
+  // average hyperedge size (and thus average hypernode degree)
+  size_t avg_degree = 4;
+  DegreeDistribution distribution = DegreeDistribution::uniform;
+  size_t repetitions = 5;
+  uint32_t seed = 0;
+};
+
+/*!
+ * Passed to each benchmark. Only the code inside measure() is timed, such that
+ * benchmarks can build their workload beforehand.
+ */
+class State {
+ public:
+  explicit State(const Parameters& parameters) :
+    _parameters(parameters),
+    _elapsed_seconds(0.0),
+    _items(0),
+    _sink(0) { }
+
+  const Parameters & parameters() const {
+    return _parameters;
+  }
+
+  template <typename F>
+  void measure(const F& f) {
+    const HighResClockTimepoint start = std::chrono::high_resolution_clock::now();
+    f();
+    const HighResClockTimepoint end = std::chrono::high_resolution_clock::now();
+    _elapsed_seconds += std::chrono::duration<double>(end - start).count();
+  }
+
+  // Number of operations performed inside measure(), used to report the time per operation.
+  void addItemsProcessed(const size_t items) {
+    _items += items;
+  }
+
+  // Prevents the compiler from optimizing away the computation of value.
+  template <typename T>
+  void doNotOptimize(const T& value) {
+    _sink = static_cast<size_t>(value);
+  }
+
+  double elapsedSeconds() const {
+    return _elapsed_seconds;
+  }
+
+  size_t itemsProcessed() const {
+    return _items;
+  }
+
+ private:
+  const Parameters& _parameters;
+  double _elapsed_seconds;
+  size_t _items;
+  volatile size_t _sink;
+};
+
+using BenchmarkFunction = void (*)(State&);
+
+class BenchmarkRegistry {
+ public:
+  static BenchmarkRegistry & instance() {
+    static BenchmarkRegistry instance;
+    return instance;
+  }
+
+  bool add(const std::string& name, const BenchmarkFunction function) {
+    _benchmarks.emplace_back(name, function);
+    return true;
+  }
+
+  const std::vector<std::pair<std::string, BenchmarkFunction> > & benchmarks() const {
+    return _benchmarks;
+  }
+
+ private:
+  BenchmarkRegistry() :
+    _benchmarks() { }
+
+  std::vector<std::pair<std::string, BenchmarkFunction> > _benchmarks;
+};
+
+struct Result {
+  std::string name;
+  double min_seconds;
+  double median_seconds;
+  size_t items;
+};
+
+// Runs the benchmark repetitions times on the same workload and reports the
+// minimum and the median running time.
+static Result run(const std::string& name, const BenchmarkFunction function,
+                  const Parameters& parameters) {
+  std::vector<double> times;
+  size_t items = 0;
+  for (size_t i = 0; i < std::max(parameters.repetitions, static_cast<size_t>(1)); ++i) {
+    State state(parameters);
+    function(state);
+    times.push_back(state.elapsedSeconds());
+    items = state.itemsProcessed();
+  }
+  std::sort(times.begin(), times.end());
+  return Result { name, times.front(), times[times.size() / 2], items };
+}
+
+static void printHeader(std::ostream& os, const bool csv) {
+  if (csv) {
+    os << "benchmark,size,k,avg_degree,distribution,min_ms,median_ms,items,ns_per_item"
+       << std::endl;
+  } else {
+    os << std::left << std::setw(48) << "benchmark" << std::right
+       << std::setw(12) << "min [ms]" << std::setw(12) << "median [ms]"
+       << std::setw(12) << "items" << std::setw(14) << "ns/item" << std::endl;
+  }
+}
+
+static void print(std::ostream& os, const Result& result, const Parameters& parameters,
+                  const bool csv) {
+  const double ns_per_item = result.items == 0 ? 0.0 :
+                             result.min_seconds * 1e9 / result.items;
+  if (csv) {
+    os << result.name << "," << parameters.size << "," << parameters.k << ","
+       << parameters.avg_degree << "," << parameters.distribution << ","
+       << result.min_seconds * 1000 << "," << result.median_seconds * 1000 << ","
+       << result.items << "," << ns_per_item << std::endl;
+  } else {
+    os << std::left << std::setw(48) << result.name << std::right << std::fixed
+       << std::setprecision(3) << std::setw(12) << result.min_seconds * 1000
+       << std::setw(12) << result.median_seconds * 1000 << std::setw(12) << result.items
+       << std::setw(14) << ns_per_item << std::endl;
+  }
+}
+}  // namespace benchmark
+}  // namespace kahypar
+
+#define KAHYPAR_BENCHMARK_CONCAT_IMPL(a, b) a ## b
+#define KAHYPAR_BENCHMARK_CONCAT(a, b) KAHYPAR_BENCHMARK_CONCAT_IMPL(a, b)
+
+// Registers function under the given name. Template instantiations have to be
+// enclosed in parentheses.
+#define KAHYPAR_BENCHMARK(name, function)                                      \
+  static const bool KAHYPAR_BENCHMARK_CONCAT(kahypar_benchmark_, __COUNTER__) =\
+    ::kahypar::benchmark::BenchmarkRegistry::instance().add(name, function)
@@ -0,0 +1,238 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2019 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "kahypar/utils/counters.h"
+
+namespace kahypar {
+namespace benchmark {
+/*!
+ * Result of one end-to-end partitioning run of the benchmark driver.
+ * Times are in seconds, the peak resident set size is in KiB.
+ */
+struct RunResult {
+  std::string config = "";
+  std::string instance = "";
+  int k = 0;
+  int seed = 0;
+  double epsilon = 0.0;
+  std::string objective = "";
+  std::string status = "failed";
+  int cut = 0;
+  int km1 = 0;
+  int soed = 0;
+  double imbalance = 0.0;
+  double total_time = 0.0;
+  double preprocessing = 0.0;
+  double coarsening = 0.0;
+  double initial_partitioning = 0.0;
+  double local_search = 0.0;
+  double v_cycle_coarsening = 0.0;
+  double v_cycle_local_search = 0.0;
+  double postprocessing = 0.0;
+  double evolutionary = 0.0;
+  long peak_rss_kb = 0;
+  // indexed by Counter, empty if the counters are disabled
+  std::vector<uint64_t> counters = { };
+
+  std::tuple<std::string, std::string, int, int> key() const {
+    return std::make_tuple(config, instance, k, seed);
+  }
+
+  int quality() const {
+    return objective == "cut" ? cut : km1;
+  }
+};
+
+static const char* kCSVHeader =
+  "config,instance,k,seed,epsilon,objective,status,cut,km1,soed,imbalance,total_time,"
+  "preprocessing,coarsening,initial_partitioning,local_search,v_cycle_coarsening,"
+  "v_cycle_local_search,postprocessing,evolutionary,peak_rss_kb";
+
+static void writeCSVRow(std::ostream& out, const RunResult& r) {
+  out << std::setprecision(std::numeric_limits<double>::max_digits10)
+      << r.config << "," << r.instance << "," << r.k << "," << r.seed << "," << r.epsilon << ","
+      << r.objective << "," << r.status << "," << r.cut << "," << r.km1 << "," << r.soed << ","
+      << r.imbalance << "," << r.total_time << "," << r.preprocessing << "," << r.coarsening
+      << "," << r.initial_partitioning << "," << r.local_search << ","
+      << r.v_cycle_coarsening << "," << r.v_cycle_local_search << "," << r.postprocessing
+      << "," << r.evolutionary << "," << r.peak_rss_kb << "\n";
+}
+
+// Returns false, if the line is not a valid row.
+static bool readCSVRow(const std::string& line, RunResult& r) {
+  std::vector<std::string> fields;
+  std::stringstream stream(line);
+  std::string field;
+  while (std::getline(stream, field, ',')) {
+    fields.push_back(field);
+  }
+  if (fields.size() != 21) {
+    return false;
+  }
+  try {
+    size_t i = 0;
+    r.config = fields[i++];
+    r.instance = fields[i++];
+    r.k = std::stoi(fields[i++]);
+    r.seed = std::stoi(fields[i++]);
+    r.epsilon = std::stod(fields[i++]);
+    r.objective = fields[i++];
+    r.status = fields[i++];
+    r.cut = std::stoi(fields[i++]);
+    r.km1 = std::stoi(fields[i++]);
+    r.soed = std::stoi(fields[i++]);
+    r.imbalance = std::stod(fields[i++]);
+    r.total_time = std::stod(fields[i++]);
+    r.preprocessing = std::stod(fields[i++]);
+    r.coarsening = std::stod(fields[i++]);
+    r.initial_partitioning = std::stod(fields[i++]);
+    r.local_search = std::stod(fields[i++]);
+    r.v_cycle_coarsening = std::stod(fields[i++]);
+    r.v_cycle_local_search = std::stod(fields[i++]);
+    r.postprocessing = std::stod(fields[i++]);
+    r.evolutionary = std::stod(fields[i++]);
+    r.peak_rss_kb = std::stol(fields[i++]);
+  } catch (const std::exception&) {
+    return false;
+  }
+  return true;
+}
+
+static void writeCSV(const std::string& filename, const std::vector<RunResult>& results) {
+  std::ofstream out(filename);
+  out << kCSVHeader << "\n";
+  for (const RunResult& result : results) {
+    writeCSVRow(out, result);
+  }
+}
+
+static std::vector<RunResult> readCSV(const std::string& filename) {
+  std::vector<RunResult> results;
+  std::ifstream in(filename);
+  std::string line;
+  while (std::getline(in, line)) {
+    RunResult result;
+    if (readCSVRow(line, result)) {
+      results.push_back(result);
+    }
+  }
+  return results;
+}
+
+static void writeJSON(const std::string& filename, const std::vector<RunResult>& results) {
+  std::ofstream out(filename);
+  out << std::setprecision(std::numeric_limits<double>::max_digits10) << "[\n";
+  for (size_t i = 0; i < results.size(); ++i) {
+    const RunResult& r = results[i];
+    out << "  {\"config\": \"" << r.config << "\", \"instance\": \"" << r.instance
+        << "\", \"k\": " << r.k << ", \"seed\": " << r.seed << ", \"epsilon\": " << r.epsilon
+        << ", \"objective\": \"" << r.objective << "\", \"status\": \"" << r.status
+        << "\", \"cut\": " << r.cut << ", \"km1\": " << r.km1 << ", \"soed\": " << r.soed
+        << ", \"imbalance\": " << r.imbalance << ", \"total_time\": " << r.total_time
+        << ", \"phases\": {\"preprocessing\": " << r.preprocessing
+        << ", \"coarsening\": " << r.coarsening
+        << ", \"initial_partitioning\": " << r.initial_partitioning
+        << ", \"local_search\": " << r.local_search
+        << ", \"v_cycle_coarsening\": " << r.v_cycle_coarsening
+        << ", \"v_cycle_local_search\": " << r.v_cycle_local_search
+        << ", \"postprocessing\": " << r.postprocessing
+        << ", \"evolutionary\": " << r.evolutionary
+        << "}, \"peak_rss_kb\": " << r.peak_rss_kb;
+    if (!r.counters.empty()) {
+      out << ", \"counters\": {";
+      for (size_t c = 0; c < r.counters.size(); ++c) {
+        out << (c > 0 ? ", " : "") << "\"" << static_cast<Counter>(c) << "\": " << r.counters[c];
+      }
+      out << "}";
+    }
+    out << "}" << (i + 1 < results.size() ? "," : "") << "\n";
+  }
+  out << "]\n";
+}
+
+struct Tolerances {
+  // relative tolerances, e.g. 0.1 allows 10% worse results than the baseline
+  double quality = 0.0;
+  double time = 0.25;
+  double memory = 0.1;
+  // absolute slack in seconds, such that very short runs do not trigger time regressions
+  double min_time = 0.05;
+};
+
+/*!
+ * Compares the results to the baseline runs with the same config, instance, k and seed
+ * and prints all regressions. Runs without a baseline are ignored.
+ * Returns the number of regressions.
+ */
+static size_t compareToBaseline(const std::vector<RunResult>& baseline,
+                                const std::vector<RunResult>& results,
+                                const Tolerances& tolerances, std::ostream& out) {
+  std::map<std::tuple<std::string, std::string, int, int>, RunResult> baseline_runs;
+  for (const RunResult& run : baseline) {
+    baseline_runs[run.key()] = run;
+  }
+
+  size_t num_regressions = 0;
+  auto report = [&](const RunResult& run, const std::string& what, const double base,
+                    const double current) {
+                  out << "REGRESSION " << what << ": " << run.config << " " << run.instance
+                      << " k=" << run.k << " seed=" << run.seed << " baseline=" << base
+                      << " current=" << current << std::endl;
+                  ++num_regressions;
+                };
+  for (const RunResult& run : results) {
+    const auto it = baseline_runs.find(run.key());
+    if (it == baseline_runs.end()) {
+      continue;
+    }
+    const RunResult& base = it->second;
+    if (run.status != "ok") {
+      if (base.status == "ok") {
+        report(run, "status", 1, 0);
+      }
+      continue;
+    }
+    if (run.quality() > base.quality() * (1.0 + tolerances.quality)) {
+      report(run, run.objective, base.quality(), run.quality());
+    }
+    if (run.total_time > base.total_time * (1.0 + tolerances.time) + tolerances.min_time) {
+      report(run, "time", base.total_time, run.total_time);
+    }
+    if (run.peak_rss_kb > base.peak_rss_kb * (1.0 + tolerances.memory)) {
+      report(run, "peak_rss_kb", base.peak_rss_kb, run.peak_rss_kb);
+    }
+  }
+  return num_regressions;
+}
+}  // namespace benchmark
+}  // namespace kahypar
@@ -0,0 +1,351 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2019 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#include <dirent.h>
+#include <sys/resource.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <boost/program_options.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "benchmarks/end_to_end.h"
+#include "benchmarks/workload.h"
+#include "kahypar/application/command_line_options.h"
+#include "kahypar/definitions.h"
+#include "kahypar/io/hypergraph_io.h"
+#include "kahypar/partition/metrics.h"
+#include "kahypar/partitioner_facade.h"
+#include "kahypar/utils/counters.h"
+#include "kahypar/utils/timer.h"
+
+namespace po = boost::program_options;
+
+namespace kahypar {
+namespace benchmark {
+static std::string basename(const std::string& path) {
+  const size_t pos = path.find_last_of('/');
+  return pos == std::string::npos ? path : path.substr(pos + 1);
+}
+
+static std::vector<std::string> iniFilesIn(const std::string& directory) {
+  std::vector<std::string> files;
+  if (DIR* dir = opendir(directory.c_str())) {
+    while (const dirent* entry = readdir(dir)) {
+      const std::string name(entry->d_name);
+      if (name.size() > 4 && name.compare(name.size() - 4, 4, ".ini") == 0) {
+        files.push_back(directory + "/" + name);
+      }
+    }
+    closedir(dir);
+  }
+  std::sort(files.begin(), files.end());
+  return files;
+}
+
+// Writes synthetic instances, such that the driver can be used without an
+// instance corpus.
+static std::vector<std::string> generateInstances(const std::string& directory,
+                                                  const size_t num_instances,
+                                                  const size_t size) {
+  std::vector<std::string> instances;
+  for (size_t i = 0; i < num_instances; ++i) {
+    Parameters parameters;
+    parameters.size = size;
+    parameters.avg_degree = 4;
+    parameters.seed = i;
+    parameters.distribution = i % 2 == 0 ? DegreeDistribution::uniform :
+                              DegreeDistribution::power_law;
+    std::stringstream filename;
+    filename << directory << "/generated_" << parameters.distribution << "_n" << size
+             << "_s" << i << ".hgr";
+    io::writeHypergraphFile(generateHypergraph(parameters), filename.str());
+    instances.push_back(filename.str());
+  }
+  return instances;
+}
+
+// Performs the partitioning in the calling (child) process.
+static RunResult partition(const std::string& config, const std::string& instance,
+                           const PartitionID k, const int seed, const double epsilon,
+                           const double time_limit) {
+  RunResult result;
+  result.config = basename(config);
+  result.instance = basename(instance);
+  result.k = k;
+  result.seed = seed;
+  result.epsilon = epsilon;
+
+  Context context;
+  parseIniToContext(context, config);
+  context.partition.graph_filename = instance;
+  context.partition.k = k;
+  context.partition.epsilon = epsilon;
+  context.partition.seed = seed;
+  context.partition.quiet_mode = true;
+  context.partition.write_partition_file = false;
+  context.partition.sp_process_output = false;
+  if (context.partition_evolutionary && context.partition.time_limit == 0) {
+    context.partition.time_limit = time_limit;
+  }
+  std::stringstream objective;
+  objective << context.partition.objective;
+  result.objective = objective.str();
+
+  Hypergraph hypergraph(io::createHypergraphFromFile(instance, k));
+  Timer::instance().clear();
+  Counters::instance().reset();
+  const HighResClockTimepoint start = std::chrono::high_resolution_clock::now();
+  PartitionerFacade().partition(hypergraph, context);
+  const HighResClockTimepoint end = std::chrono::high_resolution_clock::now();
+
+  const auto& timings = Timer::instance().result();
+  result.total_time = std::chrono::duration<double>(end - start).count();
+  result.preprocessing = timings.total_preprocessing;
+  result.coarsening = timings.total_coarsening;
+  result.initial_partitioning = timings.total_initial_partitioning;
+  result.local_search = timings.total_local_search;
+  result.v_cycle_coarsening = timings.total_v_cycle_coarsening;
+  result.v_cycle_local_search = timings.total_v_cycle_local_search;
+  result.postprocessing = timings.total_postprocessing;
+  result.evolutionary = Timer::instance().totalEvolutionaryTime();
+  result.cut = metrics::hyperedgeCut(hypergraph);
+  result.km1 = metrics::km1(hypergraph);
+  result.soed = metrics::soed(hypergraph);
+  result.imbalance = metrics::imbalance(hypergraph, context);
+  if (Counters::kEnabled) {
+    const Counters::Values counters = Counters::instance().totals();
+    result.counters.assign(counters.begin(), counters.end());
+  }
+  result.status = "ok";
+  return result;
+}
+
+/*!
+ * Each run is performed in its own child process, such that the peak resident set
+ * size of the run can be measured and a crashing run does not stop the driver.
+ * The child sends its result as a CSV row through a pipe, followed by a line with
+ * the values of the hot path counters.
+ */
+static RunResult partitionInChildProcess(const std::string& config,
+                                         const std::string& instance,
+                                         const PartitionID k, const int seed,
+                                         const double epsilon, const double time_limit) {
+  RunResult failed;
+  failed.config = basename(config);
+  failed.instance = basename(instance);
+  failed.k = k;
+  failed.seed = seed;
+  failed.epsilon = epsilon;
+
+  int fds[2];
+  if (pipe(fds) != 0) {
+    return failed;
+  }
+  std::cout.flush();
+  const pid_t pid = fork();
+  if (pid < 0) {
+    close(fds[0]);
+    close(fds[1]);
+    return failed;
+  }
+  if (pid == 0) {
+    close(fds[0]);
+    std::stringstream row;
+    const RunResult result = partition(config, instance, k, seed, epsilon, time_limit);
+    writeCSVRow(row, result);
+    for (const uint64_t value : result.counters) {
+      row << value << " ";
+    }
+    row << "\n";
+    const std::string data = row.str();
+    const ssize_t written = write(fds[1], data.data(), data.size());
+    close(fds[1]);
+    _exit(written == static_cast<ssize_t>(data.size()) ? 0 : 1);
+  }
+
+  close(fds[1]);
+  std::string data;
+  char buffer[4096];
+  ssize_t bytes = 0;
+  while ((bytes = read(fds[0], buffer, sizeof(buffer))) > 0) {
+    data.append(buffer, bytes);
+  }
+  close(fds[0]);
+
+  int status = 0;
+  struct rusage usage;
+  if (wait4(pid, &status, 0, &usage) != pid || !WIFEXITED(status) ||
+      WEXITSTATUS(status) != 0) {
+    return failed;
+  }
+  RunResult result;
+  std::stringstream lines(data);
+  std::string line;
+  if (!std::getline(lines, line) || !readCSVRow(line, result)) {
+    return failed;
+  }
+  if (std::getline(lines, line)) {
+    std::stringstream counters(line);
+    uint64_t value = 0;
+    while (counters >> value) {
+      result.counters.push_back(value);
+    }
+  }
+#ifdef __APPLE__
+  result.peak_rss_kb = usage.ru_maxrss / 1024;  // bytes
+#else
+  result.peak_rss_kb = usage.ru_maxrss;
+#endif
+  return result;
+}
+}  // namespace benchmark
+}  // namespace kahypar
+
+int main(int argc, char* argv[]) {
+  using kahypar::benchmark::RunResult;
+
+  std::vector<std::string> configs;
+  std::string config_directory = "config";
+  std::vector<std::string> instances;
+  size_t num_generated_instances = 2;
+  size_t generated_size = 10000;
+  std::string instance_directory = ".";
+  std::vector<kahypar::PartitionID> ks;
+  int num_seeds = 1;
+  double epsilon = 0.03;
+  double time_limit = 5.0;
+  std::string csv_filename;
+  std::string json_filename;
+  std::string baseline_filename;
+  kahypar::benchmark::Tolerances tolerances;
+
+  po::options_description options("End-to-End Benchmark Options");
+  options.add_options()
+    ("help", "show help message")
+    ("config", po::value<std::vector<std::string> >(&configs)->composing(),
+    "Configuration file(s) to benchmark\n"
+    "(default: all .ini files in --config-dir)")
+    ("config-dir", po::value<std::string>(&config_directory)->value_name("<string>"),
+    "Directory of the configuration files\n"
+    "(default: config)")
+    ("instance", po::value<std::vector<std::string> >(&instances)->composing(),
+    "Hypergraph file(s) to benchmark in addition to the generated instances")
+    ("generated-instances", po::value<size_t>(&num_generated_instances)->value_name("<size_t>"),
+    "Number of synthetic instances (alternating uniform/power-law degree distribution)\n"
+    "(default: 2)")
+    ("generated-size", po::value<size_t>(&generated_size)->value_name("<size_t>"),
+    "Number of hypernodes and hyperedges of the synthetic instances\n"
+    "(default: 10000)")
+    ("instance-dir", po::value<std::string>(&instance_directory)->value_name("<string>"),
+    "Directory to which the synthetic instances are written\n"
+    "(default: .)")
+    ("k", po::value<std::vector<kahypar::PartitionID> >(&ks)->composing(),
+    "Number of blocks (can be given multiple times)\n"
+    "(default: 2 and 8)")
+    ("seeds", po::value<int>(&num_seeds)->value_name("<int>"),
+    "Number of seeds per instance (seeds 1, ..., seeds)\n"
+    "(default: 1)")
+    ("epsilon", po::value<double>(&epsilon)->value_name("<double>"),
+    "Imbalance parameter\n"
+    "(default: 0.03)")
+    ("time-limit", po::value<double>(&time_limit)->value_name("<double>"),
+    "Time limit in seconds for evolutionary configurations\n"
+    "(default: 5)")
+    ("csv", po::value<std::string>(&csv_filename)->value_name("<string>"),
+    "Write results to this CSV file (can be used as baseline)")
+    ("json", po::value<std::string>(&json_filename)->value_name("<string>"),
+    "Write results to this JSON file")
+    ("baseline", po::value<std::string>(&baseline_filename)->value_name("<string>"),
+    "Compare results to this CSV file. Exits with 1 if a regression is found.")
+    ("quality-tolerance", po::value<double>(&tolerances.quality)->value_name("<double>"),
+    "Allowed relative increase of the objective compared to the baseline\n"
+    "(default: 0)")
+    ("time-tolerance", po::value<double>(&tolerances.time)->value_name("<double>"),
+    "Allowed relative increase of the running time compared to the baseline\n"
+    "(default: 0.25)")
+    ("min-time-tolerance", po::value<double>(&tolerances.min_time)->value_name("<double>"),
+    "Allowed absolute increase of the running time in seconds\n"
+    "(default: 0.05)")
+    ("memory-tolerance", po::value<double>(&tolerances.memory)->value_name("<double>"),
+    "Allowed relative increase of the peak RSS compared to the baseline\n"
+    "(default: 0.1)");
+
+  po::variables_map cmd_vm;
+  po::store(po::parse_command_line(argc, argv, options), cmd_vm);
+  po::notify(cmd_vm);
+
+  if (cmd_vm.count("help")) {
+    std::cout << options << std::endl;
+    return 0;
+  }
+  if (configs.empty()) {
+    configs = kahypar::benchmark::iniFilesIn(config_directory);
+  }
+  if (ks.empty()) {
+    ks = { 2, 8 };
+  }
+  for (const std::string& instance :
+       kahypar::benchmark::generateInstances(instance_directory, num_generated_instances,
+                                             generated_size)) {
+    instances.push_back(instance);
+  }
+
+  std::vector<RunResult> results;
+  for (const std::string& config : configs) {
+    for (const std::string& instance : instances) {
+      for (const kahypar::PartitionID k : ks) {
+        for (int seed = 1; seed <= num_seeds; ++seed) {
+          const RunResult result = kahypar::benchmark::partitionInChildProcess(
+            config, instance, k, seed, epsilon, time_limit);
+          std::cout << result.config << " " << result.instance << " k=" << result.k
+                    << " seed=" << result.seed << " " << result.status << " "
+                    << result.objective << "=" << result.quality()
+                    << " imbalance=" << result.imbalance
+                    << " time=" << result.total_time << "s"
+                    << " peak_rss=" << result.peak_rss_kb << "KiB" << std::endl;
+          results.push_back(result);
+        }
+      }
+    }
+  }
+
+  if (!csv_filename.empty()) {
+    kahypar::benchmark::writeCSV(csv_filename, results);
+  }
+  if (!json_filename.empty()) {
+    kahypar::benchmark::writeJSON(json_filename, results);
+  }
+  if (!baseline_filename.empty()) {
+    const size_t num_regressions = kahypar::benchmark::compareToBaseline(
+      kahypar::benchmark::readCSV(baseline_filename), results, tolerances, std::cout);
+    std::cout << num_regressions << " regression(s) compared to " << baseline_filename
+              << std::endl;
+    return num_regressions == 0 ? 0 : 1;
+  }
+  return 0;
+}
@@ -0,0 +1,122 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2019 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <vector>
+
+#include "benchmarks/benchmark.h"
+#include "benchmarks/workload.h"
+#include "kahypar/datastructure/hash_table.h"
+#include "kahypar/datastructure/sparse_map.h"
+#include "kahypar/datastructure/sparse_set.h"
+#include "kahypar/definitions.h"
+
+namespace kahypar {
+namespace benchmark {
+// Rating-like workload: For each hypernode, the scores of all neighbors are
+// accumulated, the best one is determined and the map is cleared.
+static void sparseMapRating(State& state) {
+  const Hypergraph hypergraph = generateHypergraph(state.parameters());
+  ds::SparseMap<HypernodeID, RatingType> ratings(hypergraph.initialNumNodes());
+
+  size_t num_pins = 0;
+  RatingType max_rating = 0.0;
+  state.measure([&]() {
+      for (const HypernodeID& hn : hypergraph.nodes()) {
+        for (const HyperedgeID& he : hypergraph.incidentEdges(hn)) {
+          const RatingType score = 1.0 / (hypergraph.edgeSize(he) - 1);
+          for (const HypernodeID& pin : hypergraph.pins(he)) {
+            ratings[pin] += score;
+            ++num_pins;
+          }
+        }
+        for (const auto& entry : ratings) {
+          max_rating = std::max(max_rating, entry.value);
+        }
+        ratings.clear();
+      }
+    });
+  state.doNotOptimize(max_rating);
+  state.addItemsProcessed(num_pins);
+}
+
+// Random mix of insertions, lookups and removals.
+static void sparseSetAddContainsRemove(State& state) {
+  const Parameters& parameters = state.parameters();
+  const std::vector<size_t> values = randomIndices(parameters, 4 * parameters.size,
+                                                   parameters.size);
+  ds::SparseSet<HypernodeID> set(parameters.size);
+
+  state.measure([&]() {
+      for (const size_t value : values) {
+        if (set.contains(value)) {
+          set.remove(value);
+        } else {
+          set.add(value);
+        }
+      }
+    });
+  state.addItemsProcessed(values.size());
+}
+
+static void hashMapAccumulate(State& state) {
+  const Parameters& parameters = state.parameters();
+  const std::vector<size_t> keys = randomIndices(parameters, parameters.size,
+                                                 4 * parameters.size);
+  ds::HashMap<HypernodeID, size_t> map(parameters.size);
+
+  size_t num_contained = 0;
+  state.measure([&]() {
+      for (const size_t key : keys) {
+        map[key] += 1;
+      }
+      for (const size_t key : keys) {
+        num_contained += map.contains(key);
+      }
+      map.clear();
+    });
+  state.doNotOptimize(num_contained);
+  state.addItemsProcessed(2 * keys.size());
+}
+
+static void insertOnlyHashSetInsertContains(State& state) {
+  const Parameters& parameters = state.parameters();
+  const std::vector<size_t> keys = randomIndices(parameters, parameters.size,
+                                                 4 * parameters.size);
+  ds::InsertOnlyHashSet<HypernodeID> set(parameters.size);
+
+  state.measure([&]() {
+      for (const size_t key : keys) {
+        if (!set.contains(key)) {
+          set.insert(key);
+        }
+      }
+      set.clear();
+    });
+  state.addItemsProcessed(keys.size());
+}
+
+KAHYPAR_BENCHMARK("sparse_map/rating", sparseMapRating);
+KAHYPAR_BENCHMARK("sparse_set/add_contains_remove", sparseSetAddContainsRemove);
+KAHYPAR_BENCHMARK("hash_map/accumulate", hashMapAccumulate);
+KAHYPAR_BENCHMARK("insert_only_hash_set/insert_contains", insertOnlyHashSetInsertContains);
+}  // namespace benchmark
+}  // namespace kahypar
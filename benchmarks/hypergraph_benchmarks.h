@@ -0,0 +1,105 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2019 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <vector>
+
+#include "benchmarks/benchmark.h"
+#include "benchmarks/workload.h"
+#include "kahypar/definitions.h"
+
+namespace kahypar {
+namespace benchmark {
+// Contracts the first two pins of the hyperedges in order until half of the
+// hypernodes are contracted.
+static std::vector<Hypergraph::Memento> contractHalf(Hypergraph& hypergraph) {
+  std::vector<Hypergraph::Memento> mementos;
+  const HypernodeID contraction_limit = hypergraph.initialNumNodes() / 2;
+  for (HyperedgeID he = 0; he < hypergraph.initialNumEdges() &&
+       hypergraph.currentNumNodes() > contraction_limit; ++he) {
+    if (!hypergraph.edgeIsEnabled(he) || hypergraph.edgeSize(he) < 2) {
+      continue;
+    }
+    const HypernodeID u = *hypergraph.pins(he).first;
+    const HypernodeID v = *(hypergraph.pins(he).first + 1);
+    mementos.push_back(hypergraph.contract(u, v));
+  }
+  return mementos;
+}
+
+static void contract(State& state) {
+  Hypergraph hypergraph = generateHypergraph(state.parameters());
+  std::vector<Hypergraph::Memento> mementos;
+  state.measure([&]() {
+      mementos = contractHalf(hypergraph);
+    });
+  state.addItemsProcessed(mementos.size());
+}
+
+static void uncontract(State& state) {
+  Hypergraph hypergraph = generateHypergraph(state.parameters());
+  const std::vector<Hypergraph::Memento> mementos = contractHalf(hypergraph);
+  const std::vector<PartitionID> partition = randomPartition(state.parameters(),
+                                                             hypergraph.initialNumNodes());
+  for (const HypernodeID& hn : hypergraph.nodes()) {
+    hypergraph.setNodePart(hn, partition[hn]);
+  }
+  hypergraph.initializeNumCutHyperedges();
+
+  state.measure([&]() {
+      for (auto it = mementos.crbegin(); it != mementos.crend(); ++it) {
+        hypergraph.uncontract(*it);
+      }
+    });
+  state.addItemsProcessed(mementos.size());
+}
+
+static void changeNodePart(State& state) {
+  const Parameters& parameters = state.parameters();
+  Hypergraph hypergraph = generateHypergraph(parameters);
+  std::vector<PartitionID> partition = randomPartition(parameters, hypergraph.initialNumNodes());
+  for (const HypernodeID& hn : hypergraph.nodes()) {
+    hypergraph.setNodePart(hn, partition[hn]);
+  }
+  hypergraph.initializeNumCutHyperedges();
+  const std::vector<size_t> moved = randomIndices(parameters, parameters.size,
+                                                  hypergraph.initialNumNodes());
+  const std::vector<PartitionID> targets = randomPartition(parameters, parameters.size);
+
+  size_t num_moves = 0;
+  state.measure([&]() {
+      for (size_t i = 0; i < moved.size(); ++i) {
+        const HypernodeID hn = moved[i];
+        if (targets[i] != partition[hn]) {
+          hypergraph.changeNodePart(hn, partition[hn], targets[i]);
+          partition[hn] = targets[i];
+          ++num_moves;
+        }
+      }
+    });
+  state.addItemsProcessed(num_moves);
+}
+
+KAHYPAR_BENCHMARK("hypergraph/contract", contract);
+KAHYPAR_BENCHMARK("hypergraph/uncontract", uncontract);
+KAHYPAR_BENCHMARK("hypergraph/change_node_part", changeNodePart);
+}  // namespace benchmark
+}  // namespace kahypar
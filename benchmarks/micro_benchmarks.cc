@@ -0,0 +1,117 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2019 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#include <boost/program_options.hpp>
+
+#include <iostream>
+#include <string>
+
+#include "benchmarks/benchmark.h"
+#include "benchmarks/hash_benchmarks.h"
+#include "benchmarks/hypergraph_benchmarks.h"
+#include "benchmarks/queue_benchmarks.h"
+#include "benchmarks/refinement_benchmarks.h"
+
+namespace po = boost::program_options;
+
+int main(int argc, char* argv[]) {
+  using kahypar::benchmark::BenchmarkRegistry;
+  using kahypar::benchmark::DegreeDistribution;
+
+  kahypar::benchmark::Parameters parameters;
+  std::string filter;
+  std::string distribution = "uniform";
+  bool csv = false;
+  bool list = false;
+
+  po::options_description options("Micro-Benchmarks Options");
+  options.add_options()
+    ("help", "show help message")
+    ("list", po::bool_switch(&list), "List all benchmarks")
+    ("filter", po::value<std::string>(&filter)->value_name("<string>"),
+    "Only run benchmarks whose name contains this string")
+    ("size", po::value<size_t>(&parameters.size)->value_name("<size_t>"),
+    "Number of hypernodes/hyperedges resp. elements of the workloads\n"
+    "(default: 100000)")
+    ("k", po::value<kahypar::PartitionID>(&parameters.k)->value_name("<int>"),
+    "Number of blocks\n"
+    "(default: 32)")
+    ("avg-degree", po::value<size_t>(&parameters.avg_degree)->value_name("<size_t>"),
+    "Average hyperedge size resp. hypernode degree\n"
+    "(default: 4)")
+    ("distribution", po::value<std::string>(&distribution)->value_name("<string>"),
+    "Degree distribution of the synthetic hypergraph:\n"
+    " - uniform\n"
+    " - power_law\n"
+    "(default: uniform)")
+    ("repetitions", po::value<size_t>(&parameters.repetitions)->value_name("<size_t>"),
+    "Number of repetitions of each benchmark\n"
+    "(default: 5)")
+    ("seed", po::value<uint32_t>(&parameters.seed)->value_name("<uint32_t>"),
+    "Seed of the workload generator\n"
+    "(default: 0)")
+    ("csv", po::bool_switch(&csv), "Print results as CSV");
+
+  po::variables_map cmd_vm;
+  po::store(po::parse_command_line(argc, argv, options), cmd_vm);
+  po::notify(cmd_vm);
+
+  if (cmd_vm.count("help")) {
+    std::cout << options << std::endl;
+    return 0;
+  }
+  if (distribution == "uniform") {
+    parameters.distribution = DegreeDistribution::uniform;
+  } else if (distribution == "power_law") {
+    parameters.distribution = DegreeDistribution::power_law;
+  } else {
+    std::cerr << "Invalid degree distribution: " << distribution << std::endl;
+    return 1;
+  }
+  if (parameters.k < 2) {
+    std::cerr << "k has to be at least 2" << std::endl;
+    return 1;
+  }
+
+  if (!csv && !list) {
+    std::cout << "size=" << parameters.size << " k=" << parameters.k
+              << " avg_degree=" << parameters.avg_degree
+              << " distribution=" << parameters.distribution
+              << " repetitions=" << parameters.repetitions
+              << " seed=" << parameters.seed << std::endl;
+  }
+  if (!list) {
+    kahypar::benchmark::printHeader(std::cout, csv);
+  }
+  for (const auto& benchmark : BenchmarkRegistry::instance().benchmarks()) {
+    if (benchmark.first.find(filter) == std::string::npos) {
+      continue;
+    }
+    if (list) {
+      std::cout << benchmark.first << std::endl;
+      continue;
+    }
+    kahypar::benchmark::print(std::cout, kahypar::benchmark::run(benchmark.first,
+                                                                 benchmark.second,
+                                                                 parameters),
+                              parameters, csv);
+  }
+  return 0;
+}
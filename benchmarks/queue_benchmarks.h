@@ -0,0 +1,100 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2019 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <limits>
+#include <vector>
+
+#include "benchmarks/benchmark.h"
+#include "benchmarks/workload.h"
+#include "kahypar/datastructure/binary_heap.h"
+#include "kahypar/datastructure/bucket_queue.h"
+#include "kahypar/datastructure/kway_priority_queue.h"
+#include "kahypar/definitions.h"
+
+namespace kahypar {
+namespace benchmark {
+// Pushes all elements, updates the keys of size random elements and
+// pops all elements.
+template <typename Queue>
+static void pushUpdatePop(State& state) {
+  const Parameters& parameters = state.parameters();
+  const HypernodeID size = parameters.size;
+  const std::vector<Gain> keys = randomGains(parameters, 2 * size);
+  const std::vector<size_t> updated = randomIndices(parameters, size, size);
+  Queue queue(size, kMaxGain + 1);
+
+  state.measure([&]() {
+      for (HypernodeID hn = 0; hn < size; ++hn) {
+        queue.push(hn, keys[hn]);
+      }
+      for (size_t i = 0; i < updated.size(); ++i) {
+        queue.updateKey(updated[i], keys[size + i]);
+      }
+      while (!queue.empty()) {
+        queue.pop();
+      }
+    });
+  state.addItemsProcessed(3 * static_cast<size_t>(size));
+}
+
+// Inserts each element into a random part, updates the keys of size random
+// elements and deletes the maximum of all enabled parts until the queue is empty.
+static void kwayInsertUpdateDeleteMax(State& state) {
+  const Parameters& parameters = state.parameters();
+  const HypernodeID size = parameters.size;
+  const std::vector<Gain> keys = randomGains(parameters, 2 * size);
+  const std::vector<size_t> updated = randomIndices(parameters, size, size);
+  const std::vector<PartitionID> parts = randomPartition(parameters, size);
+  ds::KWayPriorityQueue<HypernodeID, Gain, std::numeric_limits<Gain> > queue(parameters.k);
+#ifdef USE_BUCKET_QUEUE
+  queue.initialize(size, kMaxGain + 1);
+#else
+  queue.initialize(size);
+#endif
+
+  state.measure([&]() {
+      for (HypernodeID hn = 0; hn < size; ++hn) {
+        queue.insert(hn, parts[hn], keys[hn]);
+      }
+      for (PartitionID part = 0; part < parameters.k; ++part) {
+        queue.enablePart(part);
+      }
+      for (size_t i = 0; i < updated.size(); ++i) {
+        queue.updateKey(updated[i], parts[updated[i]], keys[size + i]);
+      }
+      HypernodeID max_hn = 0;
+      Gain max_gain = 0;
+      PartitionID max_part = 0;
+      while (!queue.empty()) {
+        queue.deleteMax(max_hn, max_gain, max_part);
+      }
+    });
+  state.addItemsProcessed(3 * static_cast<size_t>(size));
+}
+
+KAHYPAR_BENCHMARK("binary_max_heap/push_update_pop",
+                  (pushUpdatePop<ds::BinaryMaxHeap<HypernodeID, Gain> >));
+KAHYPAR_BENCHMARK("enhanced_bucket_queue/push_update_pop",
+                  (pushUpdatePop<ds::EnhancedBucketQueue<HypernodeID, Gain> >));
+KAHYPAR_BENCHMARK("kway_priority_queue/insert_update_delete_max", kwayInsertUpdateDeleteMax);
+}  // namespace benchmark
+}  // namespace kahypar
@@ -0,0 +1,99 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2019 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#include "benchmarks/benchmark.h"
+#include "benchmarks/workload.h"
+#include "kahypar/datastructure/connectivity_sets.h"
+#include "kahypar/definitions.h"
+#include "kahypar/partition/refinement/kway_fm_gain_cache.h"
+
+namespace kahypar {
+namespace benchmark {
+// Each hypernode gets entries for up to avg_degree adjacent parts. Then size
+// random delta-gain updates are performed and rolled back in batches, as done by
+// k-way FM for each local search.
+static void gainCacheUpdateRollback(State& state) {
+  const Parameters& parameters = state.parameters();
+  const HypernodeID num_nodes = parameters.size;
+  const PartitionID k = parameters.k;
+  const PartitionID num_adjacent_parts = std::min(static_cast<PartitionID>(parameters.avg_degree),
+                                                  k);
+  const std::vector<PartitionID> first_parts = randomPartition(parameters, num_nodes);
+  const std::vector<size_t> updated = randomIndices(parameters, parameters.size, num_nodes);
+  const std::vector<Gain> deltas = randomGains(parameters, parameters.size);
+  KwayGainCache<Gain> gain_cache(num_nodes, k);
+  for (HypernodeID hn = 0; hn < num_nodes; ++hn) {
+    for (PartitionID i = 0; i < num_adjacent_parts; ++i) {
+      gain_cache.initializeEntry(hn, (first_parts[hn] + i) % k, 0);
+    }
+  }
+
+  const size_t batch_size = 1000;
+  state.measure([&]() {
+      for (size_t i = 0; i < updated.size(); ++i) {
+        const HypernodeID hn = updated[i];
+        const PartitionID part = (first_parts[hn] + i % num_adjacent_parts) % k;
+        gain_cache.updateExistingEntry(hn, part, deltas[i]);
+        if ((i + 1) % batch_size == 0) {
+          gain_cache.rollbackDelta();
+        }
+      }
+      gain_cache.rollbackDelta();
+    });
+  state.addItemsProcessed(2 * updated.size());
+}
+
+// Random insertions and removals of parts into the connectivity sets of the
+// hyperedges, followed by a scan over all sets.
+static void connectivitySetsAddRemove(State& state) {
+  const Parameters& parameters = state.parameters();
+  const HyperedgeID num_edges = parameters.size;
+  const std::vector<size_t> edges = randomIndices(parameters, 4 * parameters.size, num_edges);
+  const std::vector<PartitionID> parts = randomPartition(parameters, edges.size());
+  ds::ConnectivitySets<PartitionID, HyperedgeID> connectivity_sets(num_edges);
+
+  size_t total_connectivity = 0;
+  state.measure([&]() {
+      for (size_t i = 0; i < edges.size(); ++i) {
+        if (connectivity_sets[edges[i]].contains(parts[i])) {
+          connectivity_sets[edges[i]].remove(parts[i]);
+        } else {
+          connectivity_sets[edges[i]].add(parts[i]);
+        }
+      }
+      for (HyperedgeID he = 0; he < num_edges; ++he) {
+        for (const PartitionID& part : connectivity_sets[he]) {
+          total_connectivity += part;
+        }
+      }
+    });
+  state.doNotOptimize(total_connectivity);
+  state.addItemsProcessed(edges.size() + num_edges);
+}
+
+KAHYPAR_BENCHMARK("kway_gain_cache/update_rollback", gainCacheUpdateRollback);
+KAHYPAR_BENCHMARK("connectivity_sets/add_remove", connectivitySetsAddRemove);
+}  // namespace benchmark
+}  // namespace kahypar
@@ -0,0 +1,132 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2019 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "benchmarks/benchmark.h"
+#include "kahypar/definitions.h"
+
+namespace kahypar {
+namespace benchmark {
+/*!
+ * Synthetic hypergraph with parameters.size hypernodes and hyperedges.
+ *
+ * For a uniform degree distribution, hyperedge sizes are drawn uniformly from
+ * [2, 2 * avg_degree - 2] and pins are chosen uniformly at random. For a power-law
+ * distribution, hyperedge sizes follow a power law with an exponent that yields the
+ * requested average (capped at sqrt(size)) and pins are chosen with a bias towards
+ * hypernodes with small ids, such that both hyperedge sizes and hypernode degrees
+ * are skewed.
+ */
+static Hypergraph generateHypergraph(const Parameters& parameters) {
+  const HypernodeID num_nodes = std::max(parameters.size, static_cast<size_t>(2));
+  const HyperedgeID num_edges = num_nodes;
+  const size_t avg_size = std::max(parameters.avg_degree, static_cast<size_t>(2));
+  const size_t max_size = std::max(static_cast<size_t>(std::sqrt(num_nodes)),
+                                   static_cast<size_t>(2));
+  std::mt19937 rng(parameters.seed);
+  std::uniform_real_distribution<double> real(0.0, 1.0);
+  std::uniform_int_distribution<size_t> uniform_size(2, std::max(2 * avg_size - 2,
+                                                                 static_cast<size_t>(2)));
+  std::uniform_int_distribution<HypernodeID> uniform_node(0, num_nodes - 1);
+  // p(s) ~ s^-alpha for s >= 2 has mean 2 * (alpha - 1) / (alpha - 2)
+  const double alpha = avg_size <= 2 ? 0.0 : (2.0 * avg_size - 2.0) / (avg_size - 2.0);
+
+  auto edgeSize = [&]() -> size_t {
+                    if (parameters.distribution == DegreeDistribution::uniform) {
+                      return std::min(uniform_size(rng), static_cast<size_t>(num_nodes));
+                    }
+                    if (avg_size <= 2) {
+                      return 2;
+                    }
+                    const double size = 2.0 * std::pow(1.0 - real(rng), -1.0 / (alpha - 1.0));
+                    return std::min(static_cast<size_t>(size), max_size);
+                  };
+  auto pin = [&]() -> HypernodeID {
+               if (parameters.distribution == DegreeDistribution::uniform) {
+                 return uniform_node(rng);
+               }
+               const double u = real(rng);
+               return std::min(static_cast<HypernodeID>(num_nodes * u * u * u), num_nodes - 1);
+             };
+
+  HyperedgeIndexVector index_vector;
+  HyperedgeVector edge_vector;
+  std::vector<bool> contained(num_nodes, false);
+  index_vector.push_back(0);
+  for (HyperedgeID he = 0; he < num_edges; ++he) {
+    const size_t size = edgeSize();
+    const size_t begin = edge_vector.size();
+    while (edge_vector.size() - begin < size) {
+      const HypernodeID hn = pin();
+      if (!contained[hn]) {
+        contained[hn] = true;
+        edge_vector.push_back(hn);
+      }
+    }
+    for (size_t i = begin; i < edge_vector.size(); ++i) {
+      contained[edge_vector[i]] = false;
+    }
+    index_vector.push_back(edge_vector.size());
+  }
+  return Hypergraph(num_nodes, num_edges, index_vector, edge_vector, parameters.k);
+}
+
+static std::vector<PartitionID> randomPartition(const Parameters& parameters,
+                                                const HypernodeID num_nodes) {
+  std::mt19937 rng(parameters.seed + 1);
+  std::uniform_int_distribution<PartitionID> part(0, parameters.k - 1);
+  std::vector<PartitionID> partition(num_nodes);
+  for (PartitionID& p : partition) {
+    p = part(rng);
+  }
+  return partition;
+}
+
+// Gains of FM moves are small compared to the total weight of the hyperedges.
+static constexpr Gain kMaxGain = 1024;
+
+static std::vector<Gain> randomGains(const Parameters& parameters, const size_t size) {
+  std::mt19937 rng(parameters.seed + 2);
+  std::uniform_int_distribution<Gain> gain(-kMaxGain, kMaxGain);
+  std::vector<Gain> gains(size);
+  for (Gain& g : gains) {
+    g = gain(rng);
+  }
+  return gains;
+}
+
+static std::vector<size_t> randomIndices(const Parameters& parameters, const size_t num_indices,
+                                         const size_t max_index) {
+  std::mt19937 rng(parameters.seed + 3);
+  std::uniform_int_distribution<size_t> index(0, max_index - 1);
+  std::vector<size_t> indices(num_indices);
+  for (size_t& i : indices) {
+    i = index(rng);
+  }
+  return indices;
+}
+}  // namespace benchmark
+}  // namespace kahypar
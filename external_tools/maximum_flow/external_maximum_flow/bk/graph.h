@@ -193,6 +193,7 @@ public:
 	// other functions for reading graph structure
 	int get_node_num() { return node_num; }
 	int get_arc_num() { return (int)(arc_last - arcs); }
+	long get_augmentation_num() { return augmentation_num; } // over all calls to maxflow() since the last reset()
 	void get_arc_ends(arc_id a, node_id& i, node_id& j); // returns i,j to that a = i->j
 
 	///////////////////////////////////////////////////
@@ -343,6 +344,7 @@ public:
 
 	// reusing trees & list of changed pixels
 	int					maxflow_iteration; // counter
+	long				augmentation_num; // counter
 	Block<node_id>		*changed_list;
 
 	/////////////////////////////////////////////////////////////////////////
@@ -542,6 +544,7 @@ template <typename captype, typename tcaptype, typename flowtype>
 	arc_max = arcs + 2*edge_num_max;
 
 	maxflow_iteration = 0;
+	augmentation_num = 0;
 	flow = 0;
 }
 
@@ -571,6 +574,7 @@ template <typename captype, typename tcaptype, typename flowtype>
 	}
 
 	maxflow_iteration = 0;
+	augmentation_num = 0;
 	flow = 0;
 }
 
@@ -1195,6 +1199,7 @@ template <typename captype, typename tcaptype, typename flowtype>
 
 			/* augmentation */
 			augment(a);
+			augmentation_num ++;
 			/* augmentation end */
 
 			/* adoption */
@@ -64,7 +64,11 @@ namespace maxflow {
 #define IBTEST 0
 #define IB_MIN_MARGINALS_DEBUG 0
 #define IB_MIN_MARGINALS_TEST 0
+#ifdef KAHYPAR_ENABLE_COUNTERS
+#define IBSTATS 1
+#else
 #define IBSTATS 0
+#endif
 #define IBDEBUG(X) fprintf(stdout, "\n"); fflush(stdout)
 #define IB_ALTERNATE_SMART 1
 #define IB_HYBRID_ADOPTION 1
@@ -54,11 +54,42 @@ typedef int kahypar_hypernode_weight_t;
 typedef int kahypar_hyperedge_weight_t;
 typedef unsigned int kahypar_partition_id_t;
 
+typedef enum {
+  KAHYPAR_PHASE_PREPROCESSING = 0,
+  KAHYPAR_PHASE_COARSENING = 1,
+  KAHYPAR_PHASE_INITIAL_PARTITIONING = 2,
+  KAHYPAR_PHASE_LOCAL_SEARCH = 3,
+  KAHYPAR_PHASE_V_CYCLE = 4,
+  KAHYPAR_PHASE_EVOLUTIONARY = 5,
+  KAHYPAR_PHASE_FINISHED = 6
+} kahypar_phase_t;
+
+/* Objective and imbalance of the current partition are -1 if unknown. */
+typedef void (*kahypar_progress_callback_t)(kahypar_phase_t phase,
+                                            kahypar_hyperedge_weight_t objective,
+                                            double imbalance,
+                                            void* user_data);
+
 KAHYPAR_API kahypar_context_t* kahypar_context_new();
 KAHYPAR_API void kahypar_context_free(kahypar_context_t* kahypar_context);
 KAHYPAR_API void kahypar_configure_context_from_file(kahypar_context_t* kahypar_context,
                                                      const char* ini_file_name);
 
+/* The callback is invoked whenever the partitioner enters a new phase. */
+KAHYPAR_API void kahypar_set_progress_callback(kahypar_context_t* kahypar_context,
+                                               kahypar_progress_callback_t callback,
+                                               void* user_data);
+
+/* Partitioning calls stop early after the given number of seconds (<= 0: no deadline).
+ * Stopped calls return the best partition found so far. Direct k-way and recursive
+ * bisection partitioning additionally scale down their effort to meet the deadline. */
+KAHYPAR_API void kahypar_set_deadline(kahypar_context_t* kahypar_context,
+                                      const double seconds);
+
+/* Stops the running (or the next) partitioning call of the context as soon as possible.
+ * The call returns the best partition found so far. Can be called from any thread. */
+KAHYPAR_API void kahypar_cancel(kahypar_context_t* kahypar_context);
+
 KAHYPAR_API void kahypar_set_custom_target_block_weights(const kahypar_partition_id_t num_blocks,
                                                          const kahypar_hypernode_weight_t* block_weights,
                                                          kahypar_context_t* kahypar_context);
@@ -84,6 +115,27 @@ KAHYPAR_API void kahypar_partition(const kahypar_hypernode_id_t num_vertices,
                                    kahypar_partition_id_t* partition);
 
 
+/* Partitions num_hypergraphs hypergraphs in parallel using num_threads threads
+ * (0: one thread per hardware thread). The i-th hypergraph is given in the same format
+ * as for kahypar_partition and is partitioned into num_blocks[i] blocks with imbalance
+ * parameter epsilons[i]. The weight arrays (or their entries) may be NULL for unweighted
+ * hypergraphs. The partition and the objective of the i-th hypergraph are written to
+ * partitions[i] and objectives[i]. Progress callbacks, deadlines, cancellation and custom
+ * target block weights do not apply to batch partitioning. */
+KAHYPAR_API void kahypar_partition_batch(const size_t num_hypergraphs,
+                                         const kahypar_hypernode_id_t* num_vertices,
+                                         const kahypar_hyperedge_id_t* num_hyperedges,
+                                         const double* epsilons,
+                                         const kahypar_partition_id_t* num_blocks,
+                                         const kahypar_hypernode_weight_t* const* vertex_weights,
+                                         const kahypar_hyperedge_weight_t* const* hyperedge_weights,
+                                         const size_t* const* hyperedge_indices,
+                                         const kahypar_hyperedge_id_t* const* hyperedges,
+                                         const size_t num_threads,
+                                         kahypar_hyperedge_weight_t* objectives,
+                                         kahypar_context_t* kahypar_context,
+                                         kahypar_partition_id_t* const* partitions);
+
 KAHYPAR_API void kahypar_improve_partition(const kahypar_hypernode_id_t num_vertices,
                                            const kahypar_hyperedge_id_t num_hyperedges,
                                            const double epsilon,
@@ -270,6 +270,21 @@ po::options_description createCoarseningOptionsDescription(Context& context,
     "Acceptance/Tiebreaking criterion for contraction partners having the same score:\n"
     "- best\n"
     "- best_prefer_unmatched")
+    ((initial_partitioning ? "i-c-rating-queue" : "c-rating-queue"),
+    po::value<std::string>()->value_name("<string>")->notifier(
+      [&context, initial_partitioning](const std::string& queue) {
+      if (initial_partitioning) {
+        context.initial_partitioning.coarsening.rating.queue =
+          kahypar::ratingQueueFromString(queue);
+      } else {
+        context.coarsening.rating.queue =
+          kahypar::ratingQueueFromString(queue);
+      }
+    }),
+    "Priority queue used by heavy_full and heavy_lazy coarsening to select the next contraction:\n"
+    "- binary_heap      : exact ordering of ratings\n"
+    "- quantized_bucket : constant time updates, ratings ordered up to a relative error of 2^-8\n"
+    "(default: binary_heap)")
     ((initial_partitioning ? "i-c-fixed-vertex-acceptance-criterion" : "c-fixed-vertex-acceptance-criterion"),
     po::value<std::string>()->value_name("<string>")->notifier(
       [&context, initial_partitioning](const std::string& crit) {
@@ -285,6 +300,15 @@ po::options_description createCoarseningOptionsDescription(Context& context,
     "- free_vertex_only     : Allows (free, free) and (fixed, free)\n"
     "- fixed_vertex_allowed : Allows (free, free), (fixed, free), and (fixed, fixed) \n"
     "- equivalent_vertices  : Allows (free, free), (fixed, fixed)");
+  if (!initial_partitioning) {
+    options.add_options()
+      ("c-reuse-ratings",
+      po::value<bool>(&context.coarsening.reuse_ratings)->value_name("<bool>"),
+      "Reuse the initial ratings of heavy_full and heavy_lazy coarsening in subsequent\n"
+      "V-cycles and evolutionary mutations for all hypernodes whose neighborhood\n"
+      "did not change blocks in between.\n"
+      "(default: false)");
+  }
   return options;
 }
 
@@ -380,7 +404,38 @@ po::options_description createInitialPartitioningOptionsDescription(Context& con
     "Algorithm used to create initial partition: pool ")
     ("i-runs",
     po::value<uint32_t>(&context.initial_partitioning.nruns)->value_name("<uint32_t>"),
-    "# initial partition trials");
+    "# initial partition trials")
+    ("i-num-threads",
+    po::value<size_t>(&context.initial_partitioning.num_threads)->value_name("<size_t>"),
+    "Number of threads used to execute independent initial partitioning trials.\n"
+    "Each thread partitions its own copy of the coarsest hypergraph.\n"
+    "(default: 1)")
+    ("i-gain-queue",
+    po::value<std::string>()->value_name("<string>")->notifier(
+      [&](const std::string& queue) {
+      context.initial_partitioning.gain_queue = kahypar::gainQueueFromString(queue);
+    }),
+    "Priority queue used by greedy hypergraph growing algorithms:\n"
+    " - binary_heap\n"
+    " - integer_bucket : constant time gain updates. Falls back to binary_heap if the\n"
+    "                    gain range is too large compared to the number of hypernodes.\n"
+    "(default: binary_heap)")
+    ("i-racing",
+    po::value<bool>(&context.initial_partitioning.racing)->value_name("<bool>"),
+    "Racing mode: Skip local search of trials that are already worse than the best feasible\n"
+    "initial partition by more than i-racing-margin and adaptively skip pool algorithms\n"
+    "that keep losing. Results of parallel initial partitioning then depend on thread timing.\n"
+    "(default: false)")
+    ("i-racing-margin",
+    po::value<double>(&context.initial_partitioning.racing_margin)->value_name("<double>"),
+    "Relative margin by which an unrefined trial may be worse than the best feasible\n"
+    "initial partition before its local search is skipped.\n"
+    "(default: 0.25)")
+    ("i-racing-patience",
+    po::value<uint32_t>(&context.initial_partitioning.racing_patience)->value_name("<uint32_t>"),
+    "Number of consecutive losses after which a pool algorithm is skipped.\n"
+    "Skipped algorithms are re-evaluated every i-racing-patience-th call.\n"
+    "(default: 5)");
   options.add(createCoarseningOptionsDescription(context, num_columns, true));
   options.add(createRefinementOptionsDescription(context, num_columns, true));
   return options;
@@ -437,9 +492,33 @@ po::options_description createPreprocessingOptionsDescription(Context& context,
     " - uniform\n"
     " - non_uniform\n"
     " - degree")
+    ("p-louvain-edge-weight-precision",
+    po::value<std::string>()->value_name("<string>")->notifier(
+      [&](const std::string& precision) {
+      context.preprocessing.community_detection.edge_weight_precision =
+        kahypar::edgeWeightPrecisionFromString(precision);
+    }),
+    "Type used to store the edge weights of the louvain graph:\n"
+    " - long_double\n"
+    " - double      : halves the memory of the graph\n"
+    " - float       : quarters the memory of the graph\n"
+    "(default: long_double)")
+    ("p-louvain-num-threads",
+    po::value<size_t>(&context.preprocessing.community_detection.num_threads)->value_name("<size_t>"),
+    "Number of threads used for local moving and contraction in louvain community detection\n"
+    "(default: 1)")
     ("p-reuse-communities",
     po::value<bool>(&context.preprocessing.community_detection.reuse_communities)->value_name("<bool>"),
-    "Reuse the community structure identified in the first bisection for all other bisections.");
+    "Reuse the community structure identified in the first bisection for all other bisections.")
+    ("p-cache-read",
+    po::value<std::string>(&context.preprocessing.cache_read_filename)->value_name("<string>"),
+    "Read deduplication and community detection results from a preprocessing cache file.\n"
+    "The cache is only used if it was written for the same input files and preprocessing\n"
+    "parameters. Cached communities are reused independent of the seed.")
+    ("p-cache-write",
+    po::value<std::string>(&context.preprocessing.cache_write_filename)->value_name("<string>"),
+    "Write deduplication and community detection results to a preprocessing cache file\n"
+    "(only if they were not read from a valid cache).");
   return options;
 }
 
@@ -464,6 +543,10 @@ po::options_description createEvolutionaryOptionsDescription(Context& context,
     }),
     "The dampening factor for edge frequency\n"
     "(default 0.5)")
+    ("edge-frequency-threads",
+    po::value<size_t>(&context.evolutionary.edge_frequency_num_threads)->value_name("<size_t>"),
+    "Number of threads used to update the edge frequencies of the best individuals\n"
+    "(default 1)")
     ("replace-strategy",
     po::value<std::string>()->value_name("<string>")->notifier(
       [&](const std::string& replace_strat) {
@@ -548,7 +631,60 @@ po::options_description createEvolutionaryOptionsDescription(Context& context,
       context.evolutionary.edge_frequency_chance = edge_chance;
     }),
     "The Chance of a mutation being selected as operation\n"
-    "default: 0.5)");
+    "default: 0.5)")
+    ("num-islands",
+    po::value<size_t>()->value_name("<size_t>")->notifier(
+      [&](const size_t& num_islands) {
+      context.evolutionary.num_islands = std::max(num_islands, static_cast<size_t>(1));
+    }),
+    "Number of islands, i.e. populations that evolve in parallel threads\n"
+    "(default: 1)")
+    ("migration-interval",
+    po::value<int>()->value_name("<int>")->notifier(
+      [&](const int& interval) {
+      context.evolutionary.migration_interval = std::max(interval, 1);
+    }),
+    "Number of iterations between two migrations of the island model\n"
+    "(default: 10)")
+    ("num-migrants",
+    po::value<size_t>()->value_name("<size_t>")->notifier(
+      [&](const size_t& num_migrants) {
+      context.evolutionary.num_migrants = num_migrants;
+    }),
+    "Number of best individuals an island sends to the next island per migration\n"
+    "(default: 1)")
+    ("migration-dir",
+    po::value<std::string>(&context.evolutionary.migration_directory)->value_name("<string>"),
+    "Directory via which the islands of multiple processes exchange migrants.\n"
+    "All processes have to use the same directory, input and k.\n"
+    "(default: empty, i.e. islands only exchange migrants within one process)")
+    ("num-processes",
+    po::value<size_t>()->value_name("<size_t>")->notifier(
+      [&](const size_t& num_processes) {
+      context.evolutionary.num_processes = std::max(num_processes, static_cast<size_t>(1));
+    }),
+    "Number of processes that exchange migrants via the migration directory\n"
+    "(default: 1)")
+    ("process-id",
+    po::value<size_t>(&context.evolutionary.process_id)->value_name("<size_t>"),
+    "Id of this process in [0, num-processes)\n"
+    "(default: 0)")
+    ("checkpoint-file",
+    po::value<std::string>(&context.evolutionary.checkpoint_filename)->value_name("<string>"),
+    "Periodically write the population and the state of the evolutionary algorithm\n"
+    "to this file (with multiple islands: one file per island, suffixed by the island id)")
+    ("checkpoint-interval",
+    po::value<int>()->value_name("<int>")->notifier(
+      [&](const int& interval) {
+      context.evolutionary.checkpoint_interval = std::max(interval, 0);
+    }),
+    "Seconds between two checkpoints\n"
+    "(default: 300)")
+    ("resume",
+    po::value<bool>(&context.evolutionary.resume)->value_name("<bool>"),
+    "Continue the evolutionary algorithm from the checkpoint file, if it is valid.\n"
+    "The elapsed time is counted towards the time limit.\n"
+    "(default: false)");
   return evolutionary_options;
 }
 
@@ -565,12 +701,33 @@ po::options_description createGenericOptionsDescription(Context& context,
     "Quiet Mode: Completely suppress console output")
     ("time-limit", po::value<int>(&context.partition.time_limit)->value_name("<int>"),
     "Time limit in seconds")
+    ("deadline", po::value<double>(&context.partition.deadline)->value_name("<double>"),
+    "Anytime mode: Return the best partition found within the given number of seconds.\n"
+    "Direct k-way and recursive bisection partitioning scale down the effort of\n"
+    "initial partitioning, local search and V-cycles to meet the deadline.\n"
+    "(default: disabled)")
     ("sp-process,s", po::value<bool>(&context.partition.sp_process_output)->value_name("<bool>"),
     "Summarize partitioning results in RESULT line compatible with sqlplottools "
-    "(https://github.com/bingmann/sqlplottools)");
+    "(https://github.com/bingmann/sqlplottools)")
+    ("trace-file",
+    po::value<std::string>(&context.partition.trace_filename)->value_name("<string>"),
+    "Record a timeline of all partitioning phases and write it to the given file\n"
+    "in Chrome trace format (chrome://tracing, ui.perfetto.dev).\n"
+    "(default: disabled)");
   return generic_options;
 }
 
+// The options of the evolutionary island model depend on each other and can only be
+// checked after all of them have been parsed.
+void checkMigrationOptions(const Context& context) {
+  if (context.evolutionary.process_id >= context.evolutionary.num_processes) {
+    std::cerr << "process-id (" << context.evolutionary.process_id
+              << ") has to be smaller than num-processes ("
+              << context.evolutionary.num_processes << ")" << std::endl;
+    std::exit(-1);
+  }
+}
+
 void processCommandLineInput(Context& context, int argc, char* argv[]) {
   const int num_columns = platform::getTerminalWidth();
 
@@ -664,6 +821,7 @@ void processCommandLineInput(Context& context, int argc, char* argv[]) {
 
   po::store(po::parse_config_file(file, ini_line_options, true), cmd_vm);
   po::notify(cmd_vm);
+  checkMigrationOptions(context);
 
 
   std::string epsilon_str = std::to_string(context.partition.epsilon);
@@ -705,6 +863,7 @@ void parseIniToContext(Context& context, const std::string& ini_filename) {
 
   po::store(po::parse_config_file(file, ini_line_options, true), cmd_vm);
   po::notify(cmd_vm);
+  checkMigrationOptions(context);
 
   if (context.partition.use_individual_part_weights) {
     context.partition.epsilon = 0;
@@ -0,0 +1,166 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2019 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+#include "kahypar/definitions.h"
+#include "kahypar/macros.h"
+#include "kahypar/partition/context.h"
+#include "kahypar/partition/metrics.h"
+#include "kahypar/partitioner_facade.h"
+#include "kahypar/utils/parallel.h"
+
+namespace kahypar {
+// A hypergraph of a batch in CSR format (see the raw pointer constructor of
+// Hypergraph) and the location of its result. Weights may be null.
+struct BatchInstance {
+  HypernodeID num_nodes;
+  HyperedgeID num_edges;
+  const size_t* hyperedge_indices;
+  const HypernodeID* hyperedges;
+  const HyperedgeWeight* hyperedge_weights;
+  const HypernodeWeight* node_weights;
+  PartitionID k;
+  double epsilon;
+  PartitionID* partition;
+  HyperedgeWeight* objective;
+};
+
+/*!
+ * Partitions a batch of (small) hypergraphs in parallel.
+ *
+ * The hypergraphs are distributed dynamically among a fixed set of worker threads,
+ * largest first. Each worker owns a copy of the given context, from which the context
+ * of each of its partitioning calls is copied. The result of a hypergraph therefore
+ * only depends on the hypergraph and the context, but not on the number of threads
+ * or on the scheduling.
+ *
+ * The worker contexts are quiet and do not support features that rely on state shared
+ * across partitioning calls: progress reporting, cancellation, deadlines, repeated
+ * partitioning with a time limit, timeline traces, the preprocessing cache and input
+ * partitions. Evolutionary partitioning and individual block weights are not supported.
+ *
+ * Only the contexts are reused across the partitioning calls of a worker. Each call
+ * still builds its own hypergraph, coarsener, refiners and initial partitioners, since
+ * these are bound to and sized by the hypergraph they operate on. The batch therefore
+ * saves thread creation and lets the caller release the GIL once, but the per-call
+ * setup remains: With km1_kKaHyPar_dissertation.ini, a hypergraph with 4 hypernodes
+ * takes about 0.7 ms per call, compared to 27 ms for 60 hypernodes.
+ */
+class BatchPartitioner {
+ public:
+  BatchPartitioner(const Context& context, const size_t num_threads) :
+    _num_threads(num_threads > 0 ? num_threads :
+                 std::max(static_cast<size_t>(std::thread::hardware_concurrency()),
+                          static_cast<size_t>(1))),
+    _contexts() {
+    ALWAYS_ASSERT(!context.partition_evolutionary,
+                  "Batch partitioning does not support evolutionary partitioning");
+    ALWAYS_ASSERT(!context.partition.use_individual_part_weights,
+                  "Batch partitioning does not support individual block weights");
+    // The contexts are created (and destroyed) by the calling thread,
+    // because they report their stats to the given context.
+    _contexts.reserve(_num_threads);
+    for (size_t thread = 0; thread < _num_threads; ++thread) {
+      _contexts.emplace_back(context);
+      Context& worker_context = _contexts.back();
+      worker_context.partition.quiet_mode = true;
+      worker_context.partition.verbose_output = false;
+      worker_context.partition.sp_process_output = false;
+      worker_context.partition.write_partition_file = false;
+      worker_context.partition.vcycle_refinement_for_input_partition = false;
+      worker_context.partition.time_limit = 0;
+      worker_context.partition.deadline = 0.0;
+      worker_context.partition.control = nullptr;
+      worker_context.partition.time_budget = nullptr;
+      worker_context.partition.fixed_vertex_filename.clear();
+      worker_context.partition.input_partition_filename.clear();
+      worker_context.partition.trace_filename.clear();
+      worker_context.partition.trace_recorder = nullptr;
+      worker_context.preprocessing.cache_read_filename.clear();
+      worker_context.preprocessing.cache_write_filename.clear();
+      worker_context.initial_partitioning.verbose_output = false;
+      worker_context.evolutionary.communities.clear();
+      // Partitioning calls create their own rating cache and initial partitioning race.
+      worker_context.coarsening.rating_cache = nullptr;
+      worker_context.initial_partitioning.race = nullptr;
+      worker_context.evolutionary.edge_frequency = nullptr;
+    }
+  }
+
+  BatchPartitioner(const BatchPartitioner&) = delete;
+  BatchPartitioner& operator= (const BatchPartitioner&) = delete;
+
+  BatchPartitioner(BatchPartitioner&&) = delete;
+  BatchPartitioner& operator= (BatchPartitioner&&) = delete;
+
+  ~BatchPartitioner() = default;
+
+  size_t numThreads() const {
+    return _num_threads;
+  }
+
+  void partition(const std::vector<BatchInstance>& instances) {
+    // Largest first improves the load balance of the dynamic distribution.
+    std::vector<size_t> order(instances.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](const size_t lhs, const size_t rhs) {
+        return instances[lhs].hyperedge_indices[instances[lhs].num_edges] >
+               instances[rhs].hyperedge_indices[instances[rhs].num_edges];
+      });
+
+    std::atomic<size_t> next(0);
+    const size_t num_workers = std::min(_num_threads, instances.size());
+    parallel::forEachChunk(num_workers, num_workers,
+                           [&](const size_t thread, const size_t, const size_t) {
+        for (size_t i = next++; i < order.size(); i = next++) {
+          partitionInstance(instances[order[i]], _contexts[thread]);
+        }
+      });
+  }
+
+ private:
+  static void partitionInstance(const BatchInstance& instance, const Context& worker_context) {
+    ASSERT(instance.partition != nullptr && instance.objective != nullptr);
+    Context context(worker_context);
+    context.partition.k = instance.k;
+    context.partition.epsilon = instance.epsilon;
+
+    Hypergraph hypergraph(instance.num_nodes, instance.num_edges, instance.hyperedge_indices,
+                          instance.hyperedges, instance.k, instance.hyperedge_weights,
+                          instance.node_weights);
+    PartitionerFacade().partition(hypergraph, context);
+
+    *instance.objective = metrics::correctMetric(hypergraph, context);
+    for (const HypernodeID& hn : hypergraph.nodes()) {
+      instance.partition[hn] = hypergraph.partID(hn);
+    }
+  }
+
+  const size_t _num_threads;
+  std::vector<Context> _contexts;
+};
+}  // namespace kahypar
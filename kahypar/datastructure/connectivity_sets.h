@@ -90,6 +90,10 @@ class ConnectivitySets final {
       return _contained_parts.size();
     }
 
+    size_t sizeInBytes() const {
+      return sizeof(ConnectivitySet) + _contained_parts.capacity() * sizeof(PartitionID);
+    }
+
  private:
     std::vector<PartitionID> _contained_parts;
   };
@@ -129,6 +133,15 @@ class ConnectivitySets final {
     return const_cast<ConnectivitySet&>(static_cast<const ConnectivitySets&>(*this).operator[] (he));
   }
 
+  size_t sizeInBytes() const {
+    size_t bytes = (_connectivity_sets.capacity() - _connectivity_sets.size()) *
+                   sizeof(ConnectivitySet);
+    for (const ConnectivitySet& connectivity_set : _connectivity_sets) {
+      bytes += connectivity_set.sizeInBytes();
+    }
+    return bytes;
+  }
+
  private:
   std::vector<ConnectivitySet> _connectivity_sets;
 };
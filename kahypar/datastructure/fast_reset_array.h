@@ -72,6 +72,11 @@ class FastResetArray {
     _entries[index] += delta;
   }
 
+  size_t sizeInBytes() const {
+    // _used_entries is reserved to the size of the array
+    return _used_entries.capacity() * (sizeof(size_t) + sizeof(T));
+  }
+
   void resetUsedEntries() {
     for (auto rit = _used_entries.crbegin(); rit != _used_entries.crend(); ++rit) {
       _entries[*rit] = _initial_value;
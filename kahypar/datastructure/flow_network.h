@@ -34,6 +34,7 @@
 #include "kahypar/definitions.h"
 #include "kahypar/partition/context.h"
 #include "kahypar/partition/metrics.h"
+#include "kahypar/utils/memory_tracker.h"
 #include "kahypar/utils/randomize.h"
 #include "kahypar/utils/stats.h"
 
@@ -87,7 +88,9 @@ class FlowNetwork {
     _visited(size),
     _he_visited(_hg.initialNumEdges()) { }
 
-  ~FlowNetwork() = default;
+  ~FlowNetwork() {
+    MemoryTracker::instance().report(MemoryComponent::flow_network, sizeInBytes());
+  }
 
   FlowNetwork(const FlowNetwork&) = delete;
   FlowNetwork& operator= (const FlowNetwork&) = delete;
@@ -117,6 +120,20 @@ class FlowNetwork {
     return _initial_size;
   }
 
+  size_t sizeInBytes() const {
+    size_t bytes = _nodes.sizeInBytes() + _sources.sizeInBytes() + _sinks.sizeInBytes() +
+                   _hypernodes.sizeInBytes() + _removed_hypernodes.sizeInBytes() +
+                   _pins_block0.sizeInBytes() + _pins_block1.sizeInBytes() +
+                   _contains_graph_hyperedges.sizeInBytes() +
+                   _visited.sizeInBytes() +
+                   _he_visited.sizeInBytes() +
+                   _flow_graph.capacity() * sizeof(std::vector<FlowEdge>);
+    for (const std::vector<FlowEdge>& edges : _flow_graph) {
+      bytes += edges.capacity() * sizeof(FlowEdge);
+    }
+    return bytes;
+  }
+
   // ################### Flow Network Construction ###################
 
   void buildFlowGraph() {
@@ -27,6 +27,7 @@
 #include <memory>
 #include <numeric>
 #include <set>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -37,16 +38,20 @@
 #include "kahypar/datastructure/sparse_map.h"
 #include "kahypar/definitions.h"
 #include "kahypar/partition/context.h"
+#include "kahypar/utils/parallel.h"
 #include "kahypar/utils/randomize.h"
 
 namespace kahypar {
 namespace ds {
 
-struct Edge {
+template <typename WeightType>
+struct EdgeT {
   NodeID target_node = 0;
-  EdgeWeight weight = 0.0;
+  WeightType weight = 0.0;
 };
 
+using Edge = EdgeT<EdgeWeight>;
+
 struct IncidentClusterWeight {
   ClusterID clusterID;
   EdgeWeight weight;
@@ -57,7 +62,16 @@ struct IncidentClusterWeight {
 };
 
 
-class Graph {
+/*!
+ * Graph representation used for community detection and flow-based refinement.
+ *
+ * WeightType is the type used to store edge weights. Aggregated weights (weighted
+ * degrees, total weight, incident cluster weights) are always computed using EdgeWeight.
+ * Storing edge weights as double or float instead of EdgeWeight (long double) reduces
+ * the size of each edge from 32 to 16 or 8 bytes.
+ */
+template <typename WeightType>
+class GraphT {
  private:
   static constexpr bool enable_heavy_assert = false;
 
@@ -94,11 +108,16 @@ class Graph {
  public:
   static constexpr NodeID kInvalidNode = std::numeric_limits<NodeID>::max();
   static constexpr long double kEpsilon = 1e-5;
+  using Edge = EdgeT<WeightType>;
+  // Weighted degrees and self loop weights are sums of edge weights. Graphs with float
+  // edge weights accumulate them in double.
+  using NodeWeight = typename std::conditional<std::is_same<WeightType, float>::value,
+                                               double, WeightType>::type;
   using NodeIterator = std::vector<NodeID>::const_iterator;
-  using EdgeIterator = std::vector<Edge>::const_iterator;
+  using EdgeIterator = typename std::vector<Edge>::const_iterator;
   using IncidentClusterWeightIterator = std::vector<IncidentClusterWeight>::const_iterator;
 
-  Graph(const Hypergraph& hypergraph, const Context& context) :
+  GraphT(const Hypergraph& hypergraph, const Context& context) :
     _num_nodes(0),
     _num_communities(0),
     _total_weight(0.0L),
@@ -143,7 +162,6 @@ class Graph {
     _weighted_degree.resize(_num_nodes, 0.0L);
     _cluster_id.resize(_num_nodes);
     _cluster_size.resize(_num_nodes, 1);
-    _incident_cluster_weight.resize(_num_nodes, IncidentClusterWeight(0, 0.0L));
     std::iota(_cluster_id.begin(), _cluster_id.end(), 0);
 
     if (_is_graph) {
@@ -190,7 +208,7 @@ class Graph {
     }
   }
 
-  Graph(const std::vector<NodeID>& adj_array, const std::vector<Edge>& edges) :
+  GraphT(const std::vector<NodeID>& adj_array, const std::vector<Edge>& edges) :
     _num_nodes(adj_array.size() - 1),
     _num_communities(_num_nodes),
     _total_weight(0.0L),
@@ -201,7 +219,7 @@ class Graph {
     _weighted_degree(_num_nodes, 0.0L),
     _cluster_id(_num_nodes),
     _cluster_size(_num_nodes, 1),
-    _incident_cluster_weight(_num_nodes, IncidentClusterWeight(0, 0.0L)),
+    _incident_cluster_weight(),
     _incident_cluster_weight_position(_num_nodes),
     _hypernode_mapping(_num_nodes, kInvalidNode) {
     std::iota(_cluster_id.begin(), _cluster_id.end(), 0);
@@ -218,13 +236,13 @@ class Graph {
     }
   }
 
-  Graph(const Graph& other) = delete;
-  Graph& operator= (const Graph& other) = delete;
+  GraphT(const GraphT& other) = delete;
+  GraphT& operator= (const GraphT& other) = delete;
 
-  Graph(Graph&& other) = default;
-  Graph& operator= (Graph&& other) = delete;
+  GraphT(GraphT&& other) = default;
+  GraphT& operator= (GraphT&& other) = delete;
 
-  ~Graph() = default;
+  ~GraphT() = default;
 
   std::pair<NodeIDIterator, NodeIDIterator> nodes() const {
     return std::make_pair(NodeIDIterator(0), NodeIDIterator(_num_nodes));
@@ -255,6 +273,18 @@ class Graph {
     return _edges.size();
   }
 
+  size_t sizeInBytes() const {
+    return _adj_array.capacity() * sizeof(NodeID) +
+           _edges.capacity() * sizeof(Edge) +
+           _selfloop_weight.capacity() * sizeof(NodeWeight) +
+           _weighted_degree.capacity() * sizeof(NodeWeight) +
+           _cluster_id.capacity() * sizeof(ClusterID) +
+           _cluster_size.capacity() * sizeof(size_t) +
+           _incident_cluster_weight.capacity() * sizeof(IncidentClusterWeight) +
+           _incident_cluster_weight_position.sizeInBytes() +
+           _hypernode_mapping.capacity() * sizeof(NodeID);
+  }
+
   size_t degree(const NodeID node) const {
     ASSERT(node < numNodes(), "NodeID" << node << "doesn't exist!");
     return static_cast<size_t>(_adj_array[static_cast<size_t>(node) + 1] - _adj_array[node]);
@@ -345,6 +375,16 @@ class Graph {
   }
 
 
+  // The buffer for incident cluster weights only grows to the largest number of
+  // incident clusters encountered so far instead of being allocated for all nodes.
+  void setIncidentClusterWeight(const size_t idx, const ClusterID c_id, const EdgeWeight w) {
+    if (idx < _incident_cluster_weight.size()) {
+      _incident_cluster_weight[idx] = IncidentClusterWeight(c_id, w);
+    } else {
+      _incident_cluster_weight.emplace_back(c_id, w);
+    }
+  }
+
   /**
    * Creates an iterator to all incident Clusters of Node node. Iterator points to an
    * IncidentClusterWeight-Struct which contains the incident Cluster ID and the sum of
@@ -359,7 +399,7 @@ class Graph {
     size_t idx = 0;
 
     if (clusterID(node) != -1) {
-      _incident_cluster_weight[idx] = IncidentClusterWeight(clusterID(node), 0.0L);
+      setIncidentClusterWeight(idx, clusterID(node), 0.0L);
       _incident_cluster_weight_position[clusterID(node)] = idx++;
     }
 
@@ -371,7 +411,7 @@ class Graph {
         if (_incident_cluster_weight_position.contains(c_id)) {
           _incident_cluster_weight[_incident_cluster_weight_position[c_id]].weight += w;
         } else {
-          _incident_cluster_weight[idx] = IncidentClusterWeight(c_id, w);
+          setIncidentClusterWeight(idx, c_id, w);
           _incident_cluster_weight_position[c_id] = idx++;
         }
       }
@@ -435,10 +475,12 @@ class Graph {
    * of all edges which connects two clusters. Also a mapping is created which maps the nodes of
    * the graph to the corresponding contracted nodes.
    *
+   * If num_threads > 1, the edges of the contracted graph are computed in parallel.
+   *
    * @return Pair which contains the contracted graph and a mapping from current to nodes to its
    * corresponding contrated nodes.
    */
-  std::pair<Graph, std::vector<NodeID> > contractClusters() {
+  std::pair<GraphT, std::vector<NodeID> > contractClusters(const size_t num_threads = 1) {
     std::vector<NodeID> cluster_to_node(numNodes(), kInvalidNode);
     std::vector<NodeID> node_to_contracted_node(numNodes(), kInvalidNode);
     ClusterID new_cid = 0;
@@ -475,6 +517,15 @@ class Graph {
     std::vector<ClusterID> clusterID(new_cid);
     std::iota(clusterID.begin(), clusterID.end(), 0);
 
+    if (num_threads > 1) {
+      std::vector<NodeID> new_adj_array;
+      std::vector<Edge> new_edges;
+      contractEdgesInParallel(num_threads, new_cid, new_adj_array, new_edges);
+      return std::make_pair(GraphT(std::move(new_adj_array), std::move(new_edges),
+                                   std::move(new_hypernode_mapping), std::move(clusterID)),
+                            std::move(node_to_contracted_node));
+    }
+
     std::vector<NodeID> node_ids(_num_nodes);
     std::iota(node_ids.begin(), node_ids.end(), 0);
 
@@ -511,8 +562,9 @@ class Graph {
 
     new_adj_array[new_cid] = new_edges.size();
 
-    return std::make_pair(Graph(new_adj_array, new_edges, new_hypernode_mapping, clusterID),
-                          node_to_contracted_node);
+    return std::make_pair(GraphT(std::move(new_adj_array), std::move(new_edges),
+                                 std::move(new_hypernode_mapping), std::move(clusterID)),
+                          std::move(node_to_contracted_node));
   }
 
   void printGraph() {
@@ -534,22 +586,23 @@ class Graph {
   FRIEND_TEST(ALouvainKarateClub, DoesLouvainAlgorithm);
 
 
-  Graph(const std::vector<NodeID>& adj_array, const std::vector<Edge>& edges,
-        const std::vector<NodeID>& new_hypernode_mapping,
-        const std::vector<ClusterID>& cluster_id) :
+  // Takes ownership of all arrays to avoid holding two copies of the contracted graph.
+  GraphT(std::vector<NodeID>&& adj_array, std::vector<Edge>&& edges,
+         std::vector<NodeID>&& new_hypernode_mapping,
+         std::vector<ClusterID>&& cluster_id) :
     _num_nodes(adj_array.size() - 1),
     _num_communities(0),
     _total_weight(0.0L),
     _is_graph(true),
-    _adj_array(adj_array),
-    _edges(edges),
+    _adj_array(std::move(adj_array)),
+    _edges(std::move(edges)),
     _selfloop_weight(_num_nodes, 0.0L),
     _weighted_degree(_num_nodes, 0.0L),
-    _cluster_id(cluster_id),
+    _cluster_id(std::move(cluster_id)),
     _cluster_size(_num_nodes, 0),
-    _incident_cluster_weight(_num_nodes, IncidentClusterWeight(0, 0.0L)),
+    _incident_cluster_weight(),
     _incident_cluster_weight_position(_num_nodes),
-    _hypernode_mapping(new_hypernode_mapping) {
+    _hypernode_mapping(std::move(new_hypernode_mapping)) {
     for (const NodeID& node : nodes()) {
       if (_cluster_size[_cluster_id[node]] == 0) {
         _num_communities++;
@@ -586,7 +639,7 @@ class Graph {
           const size_t i = _incident_cluster_weight_position[c_id];
           _incident_cluster_weight[i].weight += w;
         } else {
-          _incident_cluster_weight[idx] = IncidentClusterWeight(c_id, w);
+          setIncidentClusterWeight(idx, c_id, w);
           _incident_cluster_weight_position[c_id] = idx++;
         }
       }
@@ -643,6 +696,59 @@ class Graph {
     return incident_cluster_weight_range;
   }
 
+  /*!
+   * Computes the adjacency array of the contracted graph in parallel. Nodes are
+   * bucketed by their (already renumbered) cluster id and each thread aggregates the
+   * incident cluster weights of a contiguous range of clusters. The resulting edges
+   * are in the same order as in the sequential contraction.
+   */
+  void contractEdgesInParallel(const size_t num_threads, const ClusterID num_clusters,
+                               std::vector<NodeID>& new_adj_array,
+                               std::vector<Edge>& new_edges) const {
+    std::vector<NodeID> cluster_begin(static_cast<size_t>(num_clusters) + 1, 0);
+    for (const NodeID& node : nodes()) {
+      ++cluster_begin[_cluster_id[node] + 1];
+    }
+    std::partial_sum(cluster_begin.begin(), cluster_begin.end(), cluster_begin.begin());
+    std::vector<NodeID> cluster_nodes(_num_nodes);
+    std::vector<NodeID> insert_pos(cluster_begin.begin(), cluster_begin.end() - 1);
+    for (const NodeID& node : nodes()) {
+      cluster_nodes[insert_pos[_cluster_id[node]]++] = node;
+    }
+
+    const size_t num_chunks = std::max(static_cast<size_t>(1),
+                                       std::min(num_threads, static_cast<size_t>(num_clusters)));
+    std::vector<std::vector<Edge> > chunk_edges(num_chunks);
+    std::vector<NodeID> degree(num_clusters, 0);
+    parallel::forEachChunk(num_threads, num_clusters,
+                           [&](const size_t chunk, const size_t begin, const size_t end) {
+        SparseMap<ClusterID, EdgeWeight> incident_cluster_weight(num_clusters);
+        for (size_t cid = begin; cid < end; ++cid) {
+          incident_cluster_weight.clear();
+          for (NodeID i = cluster_begin[cid]; i < cluster_begin[cid + 1]; ++i) {
+            for (const Edge& e : incidentEdges(cluster_nodes[i])) {
+              incident_cluster_weight[_cluster_id[e.target_node]] += e.weight;
+            }
+          }
+          for (const auto& cluster : incident_cluster_weight) {
+            Edge e;
+            e.target_node = static_cast<NodeID>(cluster.key);
+            e.weight = cluster.value;
+            chunk_edges[chunk].push_back(e);
+          }
+          degree[cid] = incident_cluster_weight.size();
+        }
+      });
+
+    new_adj_array.assign(static_cast<size_t>(num_clusters) + 1, 0);
+    std::partial_sum(degree.begin(), degree.end(), new_adj_array.begin() + 1);
+    new_edges.clear();
+    new_edges.reserve(new_adj_array.back());
+    for (const std::vector<Edge>& edges : chunk_edges) {
+      new_edges.insert(new_edges.end(), edges.begin(), edges.end());
+    }
+  }
+
   template <typename EdgeWeightFunction>
   void constructGraph(const Hypergraph& hg, const EdgeWeightFunction& edgeWeight) {
     NodeID sum_edges = 0;
@@ -811,8 +917,8 @@ class Graph {
   bool _is_graph;
   std::vector<NodeID> _adj_array;
   std::vector<Edge> _edges;
-  std::vector<EdgeWeight> _selfloop_weight;
-  std::vector<EdgeWeight> _weighted_degree;
+  std::vector<NodeWeight> _selfloop_weight;
+  std::vector<NodeWeight> _weighted_degree;
   std::vector<ClusterID> _cluster_id;
   std::vector<size_t> _cluster_size;
   std::vector<IncidentClusterWeight> _incident_cluster_weight;
@@ -820,7 +926,13 @@ class Graph {
   std::vector<NodeID> _hypernode_mapping;
 };
 
-constexpr NodeID Graph::kInvalidNode;
-constexpr long double Graph::kEpsilon;
+template <typename WeightType>
+constexpr NodeID GraphT<WeightType>::kInvalidNode;
+template <typename WeightType>
+constexpr long double GraphT<WeightType>::kEpsilon;
+
+using Graph = GraphT<EdgeWeight>;
+using DoubleWeightGraph = GraphT<double>;
+using FloatWeightGraph = GraphT<float>;
 }  // namespace ds
 }  // namespace kahypar
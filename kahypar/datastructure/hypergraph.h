@@ -1384,11 +1384,24 @@ class GenericHypergraph {
       hypernode(i).num_incident_cut_hes = 0;
     }
     std::fill(_part_info.begin(), _part_info.end(), PartInfo());
-    std::fill(_pins_in_part.begin(), _pins_in_part.end(), 0);
+    // Only the pin counts of the blocks in the connectivity set of an enabled hyperedge
+    // are nonzero. Thus, we only have to reset connectivity(he) instead of k entries.
     for (HyperedgeID i = 0; i < _num_hyperedges; ++i) {
+      const size_t offset = static_cast<size_t>(i) * _k;
+      if (hyperedge(i).isDisabled()) {
+        std::fill(_pins_in_part.begin() + offset, _pins_in_part.begin() + offset + _k, 0);
+      } else {
+        for (const PartitionID& part : _connectivity_sets[i]) {
+          _pins_in_part[offset + part] = 0;
+        }
+      }
       hyperedge(i).connectivity = 0;
       _connectivity_sets[i].clear();
     }
+    ASSERT(std::all_of(_pins_in_part.cbegin(), _pins_in_part.cend(),
+                       [](const HypernodeID count) {
+          return count == 0;
+        }), "Pin counts were not reset");
     // Recalculate fixed vertex part weights
     HyperedgeWeight fixed_vertex_weight = 0;
     for (const HypernodeID& hn : fixedVertices()) {
@@ -1711,6 +1724,30 @@ class GenericHypergraph {
     return _fixed_vertex_total_weight;
   }
 
+  // ! Returns the memory consumption of the hypergraph in bytes, excluding _pins_in_part
+  size_t sizeInBytes() const {
+    size_t bytes = _hypernodes.capacity() * sizeof(Hypernode) +
+                   _hyperedges.capacity() * sizeof(Hyperedge) +
+                   _incidence_array.capacity() * sizeof(VertexID) +
+                   _communities.capacity() * sizeof(PartitionID) +
+                   _fixed_vertex_part_id.capacity() * sizeof(PartitionID) +
+                   _part_info.capacity() * sizeof(PartInfo) +
+                   _connectivity_sets.sizeInBytes() +
+                   _hes_not_containing_u.sizeInBytes();
+    for (const Hypernode& hn : _hypernodes) {
+      bytes += hn.incidentNets().capacity() * sizeof(HyperedgeID);
+    }
+    if (_fixed_vertices) {
+      bytes += _fixed_vertices->sizeInBytes();
+    }
+    return bytes;
+  }
+
+  // ! Returns the memory consumption of the pin counts per block in bytes
+  size_t pinsInPartSizeInBytes() const {
+    return _pins_in_part.capacity() * sizeof(HypernodeID);
+  }
+
   // ! Returns the community structure of the hypergraph
   const std::vector<PartitionID> & communities() const {
     return _communities;
@@ -2262,24 +2299,29 @@ reindex(const Hypergraph& hypergraph) {
   using HypernodeID = typename Hypergraph::HypernodeID;
   using HyperedgeID = typename Hypergraph::HyperedgeID;
 
-  std::unordered_map<HypernodeID, HypernodeID> original_to_reindexed;
+  // The mapping is a plain, uninitialized array that is only written for the enabled
+  // hypernodes, which avoids hashing and initializing it. Note that nodes() and edges()
+  // still skip over all disabled IDs, i.e., compacting a coarse hypergraph takes
+  // O(initialNumNodes() + initialNumEdges()) time in addition to the time proportional
+  // to its current number of pins.
+  std::unique_ptr<HypernodeID[]> original_to_reindexed(
+    new HypernodeID[hypergraph.initialNumNodes()]);
   std::vector<HypernodeID> reindexed_to_original;
+  reindexed_to_original.reserve(hypergraph.currentNumNodes());
   std::unique_ptr<Hypergraph> reindexed_hypergraph(new Hypergraph());
 
   reindexed_hypergraph->_k = hypergraph._k;
 
-  HypernodeID num_hypernodes = 0;
   for (const HypernodeID& hn : hypergraph.nodes()) {
     original_to_reindexed[hn] = reindexed_to_original.size();
     reindexed_to_original.push_back(hn);
-    ++num_hypernodes;
   }
+  const HypernodeID num_hypernodes = reindexed_to_original.size();
 
   if (!hypergraph._communities.empty()) {
     reindexed_hypergraph->_communities.resize(num_hypernodes, -1);
-    for (const HypernodeID& hn : hypergraph.nodes()) {
-      const HypernodeID reindexed_hn = original_to_reindexed[hn];
-      reindexed_hypergraph->_communities[reindexed_hn] = hypergraph._communities[hn];
+    for (HypernodeID hn = 0; hn < num_hypernodes; ++hn) {
+      reindexed_hypergraph->_communities[hn] = hypergraph._communities[reindexed_to_original[hn]];
     }
     ASSERT(std::none_of(reindexed_hypergraph->_communities.cbegin(),
                         reindexed_hypergraph->_communities.cend(),
@@ -2290,17 +2332,31 @@ reindex(const Hypergraph& hypergraph) {
 
   reindexed_hypergraph->_hypernodes.resize(num_hypernodes);
   reindexed_hypergraph->_num_hypernodes = num_hypernodes;
-
+  for (HypernodeID hn = 0; hn < num_hypernodes; ++hn) {
+    const HypernodeID original_hn = reindexed_to_original[hn];
+    reindexed_hypergraph->hypernode(hn).setWeight(hypergraph.nodeWeight(original_hn));
+    reindexed_hypergraph->hypernode(hn).incidentNets().reserve(hypergraph.nodeDegree(original_hn));
+    reindexed_hypergraph->_total_weight += reindexed_hypergraph->hypernode(hn).weight();
+  }
+
+  // Hyperedges and incident nets are built in a single pass over the pins.
+  // Since hyperedges are visited in increasing order, the incident nets of
+  // each hypernode are sorted.
+  reindexed_hypergraph->_hyperedges.reserve(hypergraph.currentNumEdges() + 1);
+  reindexed_hypergraph->_incidence_array.reserve(hypergraph.currentNumPins());
   HyperedgeID num_hyperedges = 0;
   HypernodeID pin_index = 0;
   for (const HyperedgeID& he : hypergraph.edges()) {
     reindexed_hypergraph->_hyperedges.emplace_back(0, 0, hypergraph.edgeWeight(he));
     ++reindexed_hypergraph->_num_hyperedges;
-    reindexed_hypergraph->_hyperedges[num_hyperedges].setFirstEntry(pin_index);
+    auto& reindexed_he = reindexed_hypergraph->hyperedge(num_hyperedges);
+    reindexed_he.setFirstEntry(pin_index);
     for (const HypernodeID& pin : hypergraph.pins(he)) {
-      reindexed_hypergraph->hyperedge(num_hyperedges).incrementSize();
-      reindexed_hypergraph->hyperedge(num_hyperedges).hash += math::hash(original_to_reindexed[pin]);
-      reindexed_hypergraph->_incidence_array.push_back(original_to_reindexed[pin]);
+      const HypernodeID reindexed_pin = original_to_reindexed[pin];
+      reindexed_he.incrementSize();
+      reindexed_he.hash += math::hash(reindexed_pin);
+      reindexed_hypergraph->_incidence_array.push_back(reindexed_pin);
+      reindexed_hypergraph->hypernode(reindexed_pin).incidentNets().push_back(num_hyperedges);
       ++pin_index;
     }
     ++num_hyperedges;
@@ -2314,33 +2370,18 @@ reindex(const Hypergraph& hypergraph) {
   reindexed_hypergraph->_type = hypergraph.type();
 
   ASSERT(reindexed_hypergraph->_incidence_array.size() == num_pins);
-  reindexed_hypergraph->_incidence_array.resize(num_pins);
   reindexed_hypergraph->_pins_in_part.resize(static_cast<size_t>(num_hyperedges) * hypergraph._k);
   reindexed_hypergraph->_hes_not_containing_u.setSize(num_hyperedges);
 
   reindexed_hypergraph->_connectivity_sets.initialize(num_hyperedges);
 
-  for (HypernodeID i = 0; i < num_hypernodes - 1; ++i) {
-    reindexed_hypergraph->hypernode(i).setWeight(hypergraph.nodeWeight(reindexed_to_original[i]));
-    reindexed_hypergraph->_total_weight += reindexed_hypergraph->hypernode(i).weight();
-  }
-
-  reindexed_hypergraph->hypernode(num_hypernodes - 1).setWeight(
-    hypergraph.nodeWeight(reindexed_to_original[num_hypernodes - 1]));
-  reindexed_hypergraph->_total_weight +=
-    reindexed_hypergraph->hypernode(num_hypernodes - 1).weight();
-
-  for (const HyperedgeID& he : reindexed_hypergraph->edges()) {
-    for (const HypernodeID& pin : reindexed_hypergraph->pins(he)) {
-      reindexed_hypergraph->hypernode(pin).incidentNets().push_back(he);
-    }
-  }
-
   reindexed_hypergraph->_part_info.resize(reindexed_hypergraph->_k);
-  for (const HypernodeID& hn : reindexed_hypergraph->nodes()) {
-    HypernodeID original_hn = reindexed_to_original[hn];
-    if (hypergraph.isFixedVertex(original_hn)) {
-      reindexed_hypergraph->setFixedVertex(hn, hypergraph.fixedVertexPartID(original_hn));
+  if (hypergraph.numFixedVertices() > 0) {
+    for (HypernodeID hn = 0; hn < num_hypernodes; ++hn) {
+      const HypernodeID original_hn = reindexed_to_original[hn];
+      if (hypergraph.isFixedVertex(original_hn)) {
+        reindexed_hypergraph->setFixedVertex(hn, hypergraph.fixedVertexPartID(original_hn));
+      }
     }
   }
 
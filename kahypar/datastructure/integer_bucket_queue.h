@@ -0,0 +1,260 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2019 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <type_traits>
+
+#include "kahypar/macros.h"
+#include "kahypar/meta/mandatory.h"
+
+namespace kahypar {
+namespace ds {
+/*!
+ * Max priority queue for integer keys within [-max_key, max_key] (e.g. gains).
+ *
+ * Each key has its own bucket, such that push, remove and key updates run in
+ * constant time. Buckets are intrusive doubly linked lists. The highest non-empty
+ * bucket is found via an occupancy bitmap, if the current maximum bucket runs empty.
+ * Elements with equal keys are returned in FIFO order.
+ *
+ * The queue needs O(max_key + max_size) memory. Thus it should only be used if
+ * the key range is known to be small compared to the number of elements.
+ */
+template <typename IDType = Mandatory,
+          typename KeyType = Mandatory>
+class IntegerBucketMaxQueue {
+ private:
+  static_assert(std::is_integral<KeyType>::value, "Integral key required.");
+
+  using BucketID = size_t;
+  using Word = uint64_t;
+
+  static constexpr size_t kWordBits = 64;
+  static constexpr IDType kInvalidID = std::numeric_limits<IDType>::max();
+  static constexpr BucketID kInvalidBucket = std::numeric_limits<BucketID>::max();
+
+  struct Element {
+    KeyType key;
+    BucketID bucket;
+    IDType prev;
+    IDType next;
+  };
+
+  struct Bucket {
+    IDType head;
+    IDType tail;
+  };
+
+ public:
+  IntegerBucketMaxQueue(const IDType max_size, const KeyType max_key) :
+    _num_elements(0),
+    _max_size(max_size),
+    _max_key(max_key),
+    _num_buckets(2 * static_cast<size_t>(max_key) + 1),
+    _max_bucket(0),
+    _elements(std::make_unique<Element[]>(max_size)),
+    _buckets(std::make_unique<Bucket[]>(_num_buckets)),
+    _occupied(std::make_unique<Word[]>(numWords())) {
+    ASSERT(max_key >= 0, V(max_key));
+    for (IDType i = 0; i < max_size; ++i) {
+      _elements[i] = { 0, kInvalidBucket, kInvalidID, kInvalidID };
+    }
+    std::memset(_occupied.get(), 0, numWords() * sizeof(Word));
+  }
+
+  IntegerBucketMaxQueue(const IntegerBucketMaxQueue&) = delete;
+  IntegerBucketMaxQueue& operator= (const IntegerBucketMaxQueue&) = delete;
+
+  IntegerBucketMaxQueue(IntegerBucketMaxQueue&&) = default;
+  IntegerBucketMaxQueue& operator= (IntegerBucketMaxQueue&&) = default;
+
+  ~IntegerBucketMaxQueue() = default;
+
+  size_t size() const {
+    return _num_elements;
+  }
+
+  bool empty() const {
+    return _num_elements == 0;
+  }
+
+  bool contains(const IDType id) const {
+    ASSERT(id < _max_size, V(id));
+    return _elements[id].bucket != kInvalidBucket;
+  }
+
+  const KeyType & getKey(const IDType id) const {
+    ASSERT(contains(id), V(id));
+    return _elements[id].key;
+  }
+
+  void clear() {
+    for (size_t word = numWords(); _num_elements > 0 && word-- > 0; ) {
+      while (_occupied[word] != 0) {
+        const BucketID bucket = word * kWordBits + __builtin_ctzll(_occupied[word]);
+        for (IDType id = _buckets[bucket].head; id != kInvalidID; id = _elements[id].next) {
+          _elements[id].bucket = kInvalidBucket;
+          --_num_elements;
+        }
+        _occupied[word] &= _occupied[word] - 1;
+      }
+    }
+    ASSERT(_num_elements == 0, V(_num_elements));
+    _max_bucket = 0;
+  }
+
+  void push(const IDType id, const KeyType key) {
+    ASSERT(!contains(id), V(id));
+    _elements[id].key = key;
+    link(id, bucketOf(key));
+    ++_num_elements;
+  }
+
+  const IDType & top() const {
+    ASSERT(!empty(), "IntegerBucketMaxQueue is empty");
+    ASSERT(isOccupied(_max_bucket), V(_max_bucket));
+    return _buckets[_max_bucket].head;
+  }
+
+  const KeyType & topKey() const {
+    ASSERT(!empty(), "IntegerBucketMaxQueue is empty");
+    return _elements[top()].key;
+  }
+
+  void pop() {
+    remove(top());
+  }
+
+  void remove(const IDType id) {
+    ASSERT(contains(id), V(id));
+    unlink(id);
+    _elements[id].bucket = kInvalidBucket;
+    --_num_elements;
+  }
+
+  void updateKey(const IDType id, const KeyType new_key) {
+    ASSERT(contains(id), V(id));
+    _elements[id].key = new_key;
+    const BucketID new_bucket = bucketOf(new_key);
+    if (new_bucket != _elements[id].bucket) {
+      unlink(id);
+      link(id, new_bucket);
+    }
+  }
+
+  void updateKeyBy(const IDType id, const KeyType key_delta) {
+    updateKey(id, _elements[id].key + key_delta);
+  }
+
+  void increaseKey(const IDType id, const KeyType new_key) {
+    updateKey(id, new_key);
+  }
+
+  void decreaseKey(const IDType id, const KeyType new_key) {
+    updateKey(id, new_key);
+  }
+
+  void increaseKeyBy(const IDType id, const KeyType key_delta) {
+    updateKeyBy(id, key_delta);
+  }
+
+  void decreaseKeyBy(const IDType id, const KeyType key_delta) {
+    updateKeyBy(id, -key_delta);
+  }
+
+ private:
+  size_t numWords() const {
+    return (_num_buckets + kWordBits - 1) / kWordBits;
+  }
+
+  BucketID bucketOf(const KeyType key) const {
+    ASSERT(key >= -_max_key && key <= _max_key, V(key) << V(_max_key));
+    return static_cast<BucketID>(key + _max_key);
+  }
+
+  bool isOccupied(const BucketID bucket) const {
+    return _occupied[bucket / kWordBits] & (static_cast<Word>(1) << (bucket % kWordBits));
+  }
+
+  // Moves _max_bucket down to the highest occupied bucket.
+  void updateMaxBucket() {
+    size_t word = _max_bucket / kWordBits;
+    Word bits = _occupied[word] & (~static_cast<Word>(0) >> (kWordBits - 1 - _max_bucket % kWordBits));
+    while (bits == 0 && word > 0) {
+      bits = _occupied[--word];
+    }
+    _max_bucket = bits == 0 ? 0 : word * kWordBits + (kWordBits - 1 - __builtin_clzll(bits));
+  }
+
+  void link(const IDType id, const BucketID bucket) {
+    ASSERT(bucket < _num_buckets, V(bucket));
+    Element& e = _elements[id];
+    e.bucket = bucket;
+    e.next = kInvalidID;
+    if (isOccupied(bucket)) {
+      e.prev = _buckets[bucket].tail;
+      _elements[e.prev].next = id;
+    } else {
+      e.prev = kInvalidID;
+      _buckets[bucket].head = id;
+      _occupied[bucket / kWordBits] |= static_cast<Word>(1) << (bucket % kWordBits);
+    }
+    _buckets[bucket].tail = id;
+    if (bucket > _max_bucket) {
+      _max_bucket = bucket;
+    }
+  }
+
+  void unlink(const IDType id) {
+    const Element& e = _elements[id];
+    if (e.prev != kInvalidID) {
+      _elements[e.prev].next = e.next;
+    } else {
+      _buckets[e.bucket].head = e.next;
+    }
+    if (e.next != kInvalidID) {
+      _elements[e.next].prev = e.prev;
+    } else {
+      _buckets[e.bucket].tail = e.prev;
+    }
+    if (_buckets[e.bucket].head == kInvalidID) {
+      _occupied[e.bucket / kWordBits] &= ~(static_cast<Word>(1) << (e.bucket % kWordBits));
+      if (e.bucket == _max_bucket) {
+        updateMaxBucket();
+      }
+    }
+  }
+
+  size_t _num_elements;
+  IDType _max_size;
+  KeyType _max_key;
+  size_t _num_buckets;
+  BucketID _max_bucket;
+  std::unique_ptr<Element[]> _elements;
+  std::unique_ptr<Bucket[]> _buckets;
+  std::unique_ptr<Word[]> _occupied;
+};
+}  // namespace ds
+}  // namespace kahypar
@@ -28,6 +28,7 @@
 #include "kahypar/definitions.h"
 #include "kahypar/macros.h"
 #include "kahypar/meta/mandatory.h"
+#include "kahypar/utils/counters.h"
 #include "kahypar/utils/randomize.h"
 
 namespace kahypar {
@@ -127,6 +128,7 @@ class KWayPriorityQueue {
 
   KAHYPAR_ATTRIBUTE_ALWAYS_INLINE void insert(const IDType id, const PartitionID part,
                                               const KeyType key) {
+    KAHYPAR_COUNT(pq_operations, 1);
     ASSERT(static_cast<unsigned int>(part) < _queues.size(), "Invalid" << V(part));
     DBG << "Insert: (" << id << "," << part << "," << key << ")";
     ASSERT((_mapping[part].index != kInvalidIndex) ||
@@ -144,6 +146,7 @@ class KWayPriorityQueue {
 
   KAHYPAR_ATTRIBUTE_ALWAYS_INLINE void deleteMax(IDType& max_id, KeyType& max_key,
                                                  PartitionID& max_part) {
+    KAHYPAR_COUNT(pq_operations, 1);
     size_t max_index = UseRandomTieBreaking ? maxIndexRandomTieBreaking() : maxIndex();
     ASSERT(max_index < _num_enabled_pqs, V(max_index));
 
@@ -171,6 +174,7 @@ class KWayPriorityQueue {
 
   KAHYPAR_ATTRIBUTE_ALWAYS_INLINE void deleteMaxFromPartition(IDType& max_id, KeyType& max_key,
                                                               PartitionID part) {
+    KAHYPAR_COUNT(pq_operations, 1);
     ASSERT(static_cast<unsigned int>(part) < _queues.size(), "Invalid" << V(part));
     size_t part_index = _mapping[part].index;
     ASSERT(part_index < _num_enabled_pqs, V(part_index));
@@ -221,6 +225,7 @@ class KWayPriorityQueue {
 
   KAHYPAR_ATTRIBUTE_ALWAYS_INLINE void updateKey(const IDType id, const PartitionID part,
                                                  const KeyType key) {
+    KAHYPAR_COUNT(pq_operations, 1);
     ASSERT(static_cast<unsigned int>(part) < _queues.size(), "Invalid" << V(part));
     ASSERT(_mapping[part].index < _num_nonempty_pqs, V(part));
     _queues[_mapping[part].index].updateKey(id, key);
@@ -228,6 +233,7 @@ class KWayPriorityQueue {
 
   KAHYPAR_ATTRIBUTE_ALWAYS_INLINE void updateKeyBy(const IDType id, const PartitionID part,
                                                    const KeyType key_delta) {
+    KAHYPAR_COUNT(pq_operations, 1);
     ASSERT(static_cast<unsigned int>(part) < _queues.size(), "Invalid" << V(part));
     ASSERT(_mapping[part].index < _num_nonempty_pqs, V(part));
     _queues[_mapping[part].index].updateKeyBy(id, key_delta);
@@ -235,6 +241,7 @@ class KWayPriorityQueue {
 
   KAHYPAR_ATTRIBUTE_ALWAYS_INLINE void remove(const IDType id,
                                               const PartitionID part) {
+    KAHYPAR_COUNT(pq_operations, 1);
     ASSERT(static_cast<unsigned int>(part) < _queues.size(), "Invalid" << V(part));
     ASSERT(_mapping[part].index < _num_nonempty_pqs, V(part));
     ASSERT(_queues[_mapping[part].index].contains(id), V(id) << V(part));
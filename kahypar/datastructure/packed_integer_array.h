@@ -0,0 +1,184 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2019 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <vector>
+
+#include "kahypar/macros.h"
+
+namespace kahypar {
+namespace ds {
+/*!
+ * Fixed-size array of unsigned integers in [0, max_value], each of which is stored
+ * with the minimal number of bits, i.e. ceil(log2(max_value + 1)). Entries do not
+ * cross word boundaries. This wastes at most bits - 1 bits per word, but allows
+ * to skip words that contain only zero entries and to compare entries word-wise.
+ */
+class PackedIntegerArray {
+ public:
+  using Word = uint64_t;
+  static constexpr uint32_t kBitsPerWord = 64;
+
+  PackedIntegerArray() :
+    _size(0),
+    _bits(1),
+    _entries_per_word(kBitsPerWord),
+    _mask(1),
+    _words() { }
+
+  PackedIntegerArray(const size_t size, const uint32_t max_value) :
+    _size(size),
+    _bits(bitsFor(max_value)),
+    _entries_per_word(kBitsPerWord / _bits),
+    _mask((Word(1) << _bits) - 1),
+    _words((size + _entries_per_word - 1) / _entries_per_word, 0) { }
+
+  PackedIntegerArray(const PackedIntegerArray&) = delete;
+  PackedIntegerArray& operator= (const PackedIntegerArray&) = delete;
+
+  PackedIntegerArray(PackedIntegerArray&&) = default;
+  PackedIntegerArray& operator= (PackedIntegerArray&&) = default;
+
+  ~PackedIntegerArray() = default;
+
+  static uint32_t bitsFor(const uint32_t max_value) {
+    uint32_t bits = 1;
+    while (bits < 32 && (max_value >> bits) != 0) {
+      ++bits;
+    }
+    return bits;
+  }
+
+  uint32_t get(const size_t i) const {
+    ASSERT(i < _size, V(i) << V(_size));
+    return (_words[i / _entries_per_word] >> shift(i)) & _mask;
+  }
+
+  void set(const size_t i, const uint32_t value) {
+    ASSERT(i < _size, V(i) << V(_size));
+    ASSERT((value & ~_mask) == 0, V(value) << V(_bits));
+    Word& word = _words[i / _entries_per_word];
+    word = (word & ~(_mask << shift(i))) | (static_cast<Word>(value) << shift(i));
+  }
+
+  size_t size() const {
+    return _size;
+  }
+
+  uint32_t bitsPerEntry() const {
+    return _bits;
+  }
+
+  size_t sizeInBytes() const {
+    return _words.size() * sizeof(Word);
+  }
+
+  void write(std::ostream& out) const {
+    const uint64_t size = _size;
+    out.write(reinterpret_cast<const char*>(&size), sizeof(size));
+    out.write(reinterpret_cast<const char*>(&_bits), sizeof(_bits));
+    out.write(reinterpret_cast<const char*>(_words.data()), _words.size() * sizeof(Word));
+  }
+
+  // Returns false, if the stream does not contain a valid array of the given size
+  // that uses the number of bits required for max_value. Both are checked before
+  // any memory is allocated, such that corrupted input cannot trigger huge allocations.
+  bool read(std::istream& in, const size_t expected_size, const uint32_t max_value) {
+    uint64_t size = 0;
+    uint32_t bits = 0;
+    in.read(reinterpret_cast<char*>(&size), sizeof(size));
+    in.read(reinterpret_cast<char*>(&bits), sizeof(bits));
+    if (!in || size != expected_size || bits != bitsFor(max_value)) {
+      return false;
+    }
+    *this = PackedIntegerArray(size, max_value);
+    in.read(reinterpret_cast<char*>(_words.data()), _words.size() * sizeof(Word));
+    return static_cast<bool>(in);
+  }
+
+  // Calls f(i, get(i)) for all nonzero entries in increasing order of i.
+  template <typename F>
+  void forEachNonzero(const F& f) const {
+    for (size_t w = 0; w < _words.size(); ++w) {
+      forEachEntryIn(w, _words[w], f);
+    }
+  }
+
+  // Calls f(i, get(i)) for all nonzero entries with begin <= i < end in increasing order
+  // of i. Only the words that contain entries of the range are visited.
+  template <typename F>
+  void forEachNonzero(const size_t begin, const size_t end, const F& f) const {
+    const size_t last_word = std::min(_words.size(),
+                                      (end + _entries_per_word - 1) / _entries_per_word);
+    for (size_t w = begin / _entries_per_word; w < last_word; ++w) {
+      forEachEntryIn(w, _words[w], [&](const size_t i, const uint32_t value) {
+          if (i >= begin && i < end) {
+            f(i, value);
+          }
+        });
+    }
+  }
+
+  // Calls f(i, get(i), other.get(i)) for all entries i that differ in both arrays
+  // in increasing order of i. Both arrays have to use the same number of bits.
+  template <typename F>
+  void forEachDifference(const PackedIntegerArray& other, const F& f) const {
+    ASSERT(_size == other._size && _bits == other._bits);
+    for (size_t w = 0; w < _words.size(); ++w) {
+      const Word word = _words[w];
+      const Word other_word = other._words[w];
+      if (word != other_word) {
+        forEachEntryIn(w, word ^ other_word, [&](const size_t i, uint32_t) {
+            f(i, get(i), other.get(i));
+          });
+      }
+    }
+  }
+
+ private:
+  uint32_t shift(const size_t i) const {
+    return (i % _entries_per_word) * _bits;
+  }
+
+  // Calls f for all entries that have at least one bit set in word.
+  template <typename F>
+  void forEachEntryIn(const size_t w, Word word, const F& f) const {
+    while (word != 0) {
+      const uint32_t entry = __builtin_ctzll(word) / _bits;
+      const uint32_t entry_shift = entry * _bits;
+      f(w * _entries_per_word + entry, (word >> entry_shift) & _mask);
+      word &= ~(_mask << entry_shift);
+    }
+  }
+
+  size_t _size;
+  uint32_t _bits;
+  uint32_t _entries_per_word;
+  Word _mask;
+  std::vector<Word> _words;
+};
+}  // namespace ds
+}  // namespace kahypar
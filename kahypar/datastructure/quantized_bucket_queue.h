@@ -0,0 +1,247 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2019 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <type_traits>
+
+#include "kahypar/macros.h"
+#include "kahypar/meta/mandatory.h"
+
+namespace kahypar {
+namespace ds {
+/*!
+ * Max priority queue for floating point keys (e.g. vertex pair ratings).
+ *
+ * Keys are mapped to one of 2^(8 + MantissaBits) buckets using the order-preserving
+ * bit representation of the key as single precision float truncated to MantissaBits
+ * mantissa bits. Thus all keys within a bucket differ by a relative error of at most
+ * 2^-MantissaBits and top() returns an element whose key is within this error of the
+ * maximum key. In exchange, all operations except top()/pop() run in constant time and
+ * top() only has to inspect a two-level occupancy bitmap.
+ * Keys <= 0 are all mapped to the lowest bucket.
+ *
+ * Buckets are intrusive doubly linked lists, such that the queue only needs
+ * O(#buckets / 8 + max_size) memory and clear() is proportional to the number
+ * of contained elements.
+ */
+template <typename IDType = Mandatory,
+          typename KeyType = Mandatory,
+          size_t MantissaBits = 8>
+class QuantizedBucketMaxQueue {
+ private:
+  static_assert(std::is_floating_point<KeyType>::value, "Floating point key required.");
+  static_assert(MantissaBits <= 16, "Too many buckets.");
+
+  using BucketID = uint32_t;
+  using Word = uint64_t;
+
+  static constexpr size_t kWordBits = 64;
+  static constexpr size_t kShift = 23 - MantissaBits;
+  // +1 because bucket 0 is reserved for keys <= 0
+  static constexpr size_t kNumBuckets = (static_cast<size_t>(1) << (8 + MantissaBits)) + 1;
+  static constexpr size_t kNumWords = (kNumBuckets + kWordBits - 1) / kWordBits;
+  static constexpr size_t kNumSummaryWords = (kNumWords + kWordBits - 1) / kWordBits;
+  static constexpr IDType kInvalidID = std::numeric_limits<IDType>::max();
+  static constexpr BucketID kInvalidBucket = std::numeric_limits<BucketID>::max();
+
+  struct Element {
+    KeyType key;
+    BucketID bucket;
+    IDType prev;
+    IDType next;
+  };
+
+ public:
+  // Second parameter is used to satisfy EnhancedBucketPQ interface
+  explicit QuantizedBucketMaxQueue(const IDType max_size,
+                                   const KeyType& UNUSED(unused) = 0) :
+    _num_elements(0),
+    _max_size(max_size),
+    _elements(std::make_unique<Element[]>(max_size)),
+    _heads(std::make_unique<IDType[]>(kNumBuckets)),
+    _occupied(std::make_unique<Word[]>(kNumWords)),
+    _summary(std::make_unique<Word[]>(kNumSummaryWords)) {
+    for (IDType i = 0; i < max_size; ++i) {
+      _elements[i] = { 0, kInvalidBucket, kInvalidID, kInvalidID };
+    }
+    std::memset(_occupied.get(), 0, kNumWords * sizeof(Word));
+    std::memset(_summary.get(), 0, kNumSummaryWords * sizeof(Word));
+  }
+
+  QuantizedBucketMaxQueue(const QuantizedBucketMaxQueue&) = delete;
+  QuantizedBucketMaxQueue& operator= (const QuantizedBucketMaxQueue&) = delete;
+
+  QuantizedBucketMaxQueue(QuantizedBucketMaxQueue&&) = default;
+  QuantizedBucketMaxQueue& operator= (QuantizedBucketMaxQueue&&) = default;
+
+  ~QuantizedBucketMaxQueue() = default;
+
+  size_t size() const {
+    return _num_elements;
+  }
+
+  bool empty() const {
+    return _num_elements == 0;
+  }
+
+  bool contains(const IDType id) const {
+    ASSERT(id < _max_size, V(id));
+    return _elements[id].bucket != kInvalidBucket;
+  }
+
+  const KeyType & getKey(const IDType id) const {
+    ASSERT(contains(id), V(id));
+    return _elements[id].key;
+  }
+
+  void clear() {
+    for (size_t s = 0; s < kNumSummaryWords; ++s) {
+      while (_summary[s] != 0) {
+        const size_t word = s * kWordBits + __builtin_ctzll(_summary[s]);
+        while (_occupied[word] != 0) {
+          const size_t bucket = word * kWordBits + __builtin_ctzll(_occupied[word]);
+          for (IDType id = _heads[bucket]; id != kInvalidID; id = _elements[id].next) {
+            _elements[id].bucket = kInvalidBucket;
+          }
+          _occupied[word] &= _occupied[word] - 1;
+        }
+        _summary[s] &= _summary[s] - 1;
+      }
+    }
+    _num_elements = 0;
+  }
+
+  void push(const IDType id, const KeyType key) {
+    ASSERT(!contains(id), V(id));
+    _elements[id].key = key;
+    link(id, bucketOf(key));
+    ++_num_elements;
+  }
+
+  const IDType & top() const {
+    ASSERT(!empty(), "QuantizedBucketMaxQueue is empty");
+    return _heads[maxBucket()];
+  }
+
+  const KeyType & topKey() const {
+    ASSERT(!empty(), "QuantizedBucketMaxQueue is empty");
+    return _elements[_heads[maxBucket()]].key;
+  }
+
+  void pop() {
+    remove(top());
+  }
+
+  void remove(const IDType id) {
+    ASSERT(contains(id), V(id));
+    unlink(id);
+    _elements[id].bucket = kInvalidBucket;
+    --_num_elements;
+  }
+
+  void updateKey(const IDType id, const KeyType new_key) {
+    ASSERT(contains(id), V(id));
+    _elements[id].key = new_key;
+    const BucketID new_bucket = bucketOf(new_key);
+    if (new_bucket != _elements[id].bucket) {
+      unlink(id);
+      link(id, new_bucket);
+    }
+  }
+
+  void increaseKey(const IDType id, const KeyType new_key) {
+    updateKey(id, new_key);
+  }
+
+  void decreaseKey(const IDType id, const KeyType new_key) {
+    updateKey(id, new_key);
+  }
+
+ private:
+  static BucketID bucketOf(const KeyType key) {
+    const float f = static_cast<float>(key);
+    if (!(f > 0.0f)) {
+      return 0;
+    }
+    uint32_t bits;
+    std::memcpy(&bits, &f, sizeof(bits));
+    // For positive IEEE 754 floats, the bit representation is monotone in the value.
+    return static_cast<BucketID>(bits >> kShift) + 1;
+  }
+
+  BucketID maxBucket() const {
+    size_t s = kNumSummaryWords;
+    do {
+      --s;
+    } while (_summary[s] == 0);
+    const size_t word = s * kWordBits + (kWordBits - 1 - __builtin_clzll(_summary[s]));
+    ASSERT(_occupied[word] != 0, V(word));
+    return word * kWordBits + (kWordBits - 1 - __builtin_clzll(_occupied[word]));
+  }
+
+  void link(const IDType id, const BucketID bucket) {
+    ASSERT(bucket < kNumBuckets, V(bucket));
+    const size_t word = bucket / kWordBits;
+    const Word mask = static_cast<Word>(1) << (bucket % kWordBits);
+    const IDType head = (_occupied[word] & mask) ? _heads[bucket] : kInvalidID;
+    _elements[id].bucket = bucket;
+    _elements[id].prev = kInvalidID;
+    _elements[id].next = head;
+    if (head != kInvalidID) {
+      _elements[head].prev = id;
+    }
+    _heads[bucket] = id;
+    _occupied[word] |= mask;
+    _summary[word / kWordBits] |= static_cast<Word>(1) << (word % kWordBits);
+  }
+
+  void unlink(const IDType id) {
+    const Element& e = _elements[id];
+    if (e.prev != kInvalidID) {
+      _elements[e.prev].next = e.next;
+    } else {
+      _heads[e.bucket] = e.next;
+    }
+    if (e.next != kInvalidID) {
+      _elements[e.next].prev = e.prev;
+    }
+    if (_heads[e.bucket] == kInvalidID) {
+      const size_t word = e.bucket / kWordBits;
+      _occupied[word] &= ~(static_cast<Word>(1) << (e.bucket % kWordBits));
+      if (_occupied[word] == 0) {
+        _summary[word / kWordBits] &= ~(static_cast<Word>(1) << (word % kWordBits));
+      }
+    }
+  }
+
+  size_t _num_elements;
+  IDType _max_size;
+  std::unique_ptr<Element[]> _elements;
+  std::unique_ptr<IDType[]> _heads;
+  std::unique_ptr<Word[]> _occupied;
+  std::unique_ptr<Word[]> _summary;
+};
+}  // namespace ds
+}  // namespace kahypar
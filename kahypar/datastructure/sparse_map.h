@@ -56,6 +56,14 @@ class SparseMapBase {
     return _size;
   }
 
+  size_t sizeInBytes() const {
+    if (!_sparse) {
+      return 0;
+    }
+    const size_t max_size = reinterpret_cast<const size_t*>(_dense) - _sparse.get();
+    return max_size * (sizeof(size_t) + sizeof(MapElement));
+  }
+
   bool contains(const Key key) const {
     return static_cast<const Derived*>(this)->containsImpl(key);
   }
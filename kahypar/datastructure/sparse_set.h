@@ -75,6 +75,10 @@ class SparseSetBase {
     static_cast<Derived*>(this)->clearImpl();
   }
 
+  size_t sizeInBytes() const {
+    return _sparse ? 2 * static_cast<size_t>(_dense - _sparse.get()) * sizeof(ValueType) : 0;
+  }
+
  protected:
   explicit SparseSetBase(const ValueType k) :
     _size(0),
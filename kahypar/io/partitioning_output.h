@@ -24,6 +24,7 @@
 #include <chrono>
 #include <iostream>
 #include <numeric>
+#include <sstream>
 #include <string>
 #include <utility>
 #include <vector>
@@ -33,6 +34,7 @@
 #include "kahypar/partition/context.h"
 #include "kahypar/partition/metrics.h"
 #include "kahypar/utils/math.h"
+#include "kahypar/utils/memory_tracker.h"
 #include "kahypar/utils/timer.h"
 
 namespace kahypar {
@@ -214,6 +216,38 @@ inline void printQualityOfInitialSolution(const Hypergraph& hypergraph, const Co
   printPartSizesAndWeights(hypergraph);
 }
 
+template <typename T>
+inline std::string memoryLabel(const std::string& prefix, const T& name) {
+  std::ostringstream label;
+  label << prefix << name;
+  std::string result = label.str();
+  result.resize(std::max(result.size(), static_cast<size_t>(35)), ' ');
+  return result + "=";
+}
+
+inline double toMiB(const size_t bytes) {
+  return static_cast<double>(bytes) / (1024.0 * 1024.0);
+}
+
+inline void printMemoryConsumption() {
+  const auto& timings = Timer::instance().result();
+  LOG << "\nMemory:";
+  LOG << memoryLabel("Peak RSS", "") << toMiB(timings.peak_rss) << "MiB";
+  for (size_t i = 0; i < timings.peak_rss_increase.size(); ++i) {
+    if (timings.peak_rss_increase[i] > 0) {
+      LOG << memoryLabel("  + ", static_cast<Timepoint>(i))
+          << toMiB(timings.peak_rss_increase[i]) << "MiB";
+    }
+  }
+  LOG << "Largest data structures:";
+  const MemoryTracker::Sizes sizes = MemoryTracker::instance().peakSizes();
+  for (size_t i = 0; i < sizes.size(); ++i) {
+    if (sizes[i] > 0) {
+      LOG << memoryLabel("  | ", static_cast<MemoryComponent>(i)) << toMiB(sizes[i]) << "MiB";
+    }
+  }
+}
+
 inline void printPartitioningResults(const Hypergraph& hypergraph,
                                      const Context& context,
                                      const std::chrono::duration<double>& elapsed_seconds) {
@@ -287,6 +321,9 @@ inline void printPartitioningResults(const Hypergraph& hypergraph,
     }
     LOG << "  + Postprocessing                 =" << timings.total_postprocessing << "s";
     LOG << "    | undo sparsifier              =" << timings.post_sparsifier_restore << "s";
+    if (context.partition.verbose_output) {
+      printMemoryConsumption();
+    }
   }
   LOG << "";
 }
@@ -30,6 +30,8 @@
 #include "kahypar/partition/evolutionary/individual.h"
 #include "kahypar/partition/metrics.h"
 #include "kahypar/partition/partitioner.h"
+#include "kahypar/utils/counters.h"
+#include "kahypar/utils/memory_tracker.h"
 
 namespace kahypar {
 namespace io {
@@ -248,8 +250,23 @@ static inline void serialize(const Context& context, const Hypergraph& hypergrap
       }
     }
 
-    oss << " " << context.stats.serialize().str()
-        << " git=" << STR(KaHyPar_BUILD_VERSION)
+    oss << " " << context.stats.serialize().str();
+    if (Counters::kEnabled) {
+      const Counters::Values counters = Counters::instance().totals();
+      for (size_t i = 0; i < Counters::kNumCounters; ++i) {
+        oss << " counter_" << static_cast<Counter>(i) << "=" << counters[i];
+      }
+    }
+    oss << " peak_rss=" << timings.peak_rss;
+    for (size_t i = 0; i < timings.peak_rss_increase.size(); ++i) {
+      oss << " peak_rss_increase_" << static_cast<Timepoint>(i) << "="
+          << timings.peak_rss_increase[i];
+    }
+    const MemoryTracker::Sizes memory = MemoryTracker::instance().peakSizes();
+    for (size_t i = 0; i < memory.size(); ++i) {
+      oss << " memory_" << static_cast<MemoryComponent>(i) << "=" << memory[i];
+    }
+    oss << " git=" << STR(KaHyPar_BUILD_VERSION)
         << std::endl;
 
     std::cout << oss.str() << std::endl;
@@ -281,7 +298,7 @@ static inline void serializeEvolutionary(const Context& context, const Hypergrap
   oss << "RESULT "
       << "connectivity=" << metrics::km1(hg)
       << " action=" << context.evolutionary.action.decision()
-      << " time-total=" << Timer::instance().evolutionaryResult().total_evolutionary
+      << " time-total=" << Timer::instance().totalEvolutionaryTime()
       << " iteration=" << context.evolutionary.iteration
       << " replace-strategy=" << context.evolutionary.replace_strategy
       << " combine-strategy=" << combine_strat
@@ -35,6 +35,7 @@
 #include "kahypar/partition/context.h"
 #include "kahypar/partition/metrics.h"
 #include "kahypar/partition/refinement/i_refiner.h"
+#include "kahypar/utils/memory_tracker.h"
 
 namespace kahypar {
 class CoarsenerBase {
@@ -61,7 +62,9 @@ class CoarsenerBase {
                                                         weight_of_heaviest_node });
   }
 
-  virtual ~CoarsenerBase() = default;
+  virtual ~CoarsenerBase() {
+    MemoryTracker::instance().report(MemoryComponent::coarsening_history, sizeInBytes());
+  }
 
   CoarsenerBase(const CoarsenerBase&) = delete;
   CoarsenerBase& operator= (const CoarsenerBase&) = delete;
@@ -69,6 +72,13 @@ class CoarsenerBase {
   CoarsenerBase(CoarsenerBase&&) = delete;
   CoarsenerBase& operator= (CoarsenerBase&&) = delete;
 
+  // Memory consumption of the contraction history and the hypergraph pruner in bytes
+  size_t sizeInBytes() const {
+    return _history.capacity() * sizeof(CoarseningMemento) +
+           _max_hn_weights.capacity() * sizeof(CurrentMaxNodeWeight) +
+           _hypergraph_pruner.sizeInBytes();
+  }
+
  protected:
   void performContraction(const HypernodeID rep_node, const HypernodeID contracted_node) {
     _history.emplace_back(_hg.contract(rep_node, contracted_node));
@@ -33,6 +33,7 @@
 #include "kahypar/partition/coarsening/policies/rating_community_policy.h"
 #include "kahypar/partition/coarsening/policies/rating_heavy_node_penalty_policy.h"
 #include "kahypar/partition/coarsening/policies/rating_partition_policy.h"
+#include "kahypar/partition/coarsening/policies/rating_queue_policy.h"
 #include "kahypar/partition/coarsening/policies/rating_score_policy.h"
 #include "kahypar/partition/coarsening/policies/rating_tie_breaking_policy.h"
 #include "kahypar/partition/coarsening/vertex_pair_coarsener_base.h"
@@ -45,9 +46,12 @@ template <class ScorePolicy = HeavyEdgeScore,
           class RatingPartitionPolicy = NormalPartitionPolicy,
           class AcceptancePolicy = BestRatingWithTieBreaking<>,
           class FixedVertexPolicy = AllowFreeOnFixedFreeOnFreeFixedOnFixed,
-          typename RatingType = RatingType>
+          typename RatingType = RatingType,
+          class RatingQueuePolicy = BinaryHeapRatingQueue>
 class FullVertexPairCoarsener final : public ICoarsener,
-                                      private VertexPairCoarsenerBase<>{
+                                      private VertexPairCoarsenerBase<
+                                        typename RatingQueuePolicy::template PriorityQueue<
+                                          HypernodeID, RatingType> >{
  private:
   static constexpr bool debug = false;
 
@@ -59,15 +63,17 @@ class FullVertexPairCoarsener final : public ICoarsener,
                                 FixedVertexPolicy,
                                 RatingType>;
 
-  using Base = VertexPairCoarsenerBase;
+  using Base = VertexPairCoarsenerBase<
+    typename RatingQueuePolicy::template PriorityQueue<HypernodeID, RatingType> >;
   using Rating = typename Rater::Rating;
 
  public:
   FullVertexPairCoarsener(Hypergraph& hypergraph, const Context& context,
                           const HypernodeWeight weight_of_heaviest_node) :
-    VertexPairCoarsenerBase(hypergraph, context, weight_of_heaviest_node),
+    Base(hypergraph, context, weight_of_heaviest_node),
     _rater(_hg, _context),
-    _target(hypergraph.initialNumNodes()) { }
+    _target(hypergraph.initialNumNodes()),
+    _affected_hypernodes() { }
 
   ~FullVertexPairCoarsener() override = default;
 
@@ -83,14 +89,14 @@ class FullVertexPairCoarsener final : public ICoarsener,
   void coarsenImpl(const HypernodeID limit) override final {
     _pq.clear();
 
-    rateAllHypernodes(_rater, _target);
+    Base::rateAllHypernodes(_rater, _target);
 
     ds::FastResetFlagArray<> rerated_hypernodes(_hg.initialNumNodes());
     // Used to prevent unnecessary re-rating of hypernodes that have been removed from
     // PQ because they are heavier than allowed.
     ds::FastResetFlagArray<> invalid_hypernodes(_hg.initialNumNodes());
 
-    while (!_pq.empty() && _hg.currentNumNodes() > limit) {
+    while (!_pq.empty() && _hg.currentNumNodes() > limit && !_context.isCancelled()) {
       const HypernodeID rep_node = _pq.top();
       const HypernodeID contracted_node = _target[rep_node];
       DBG << "Contracting: (" << rep_node << ","
@@ -108,7 +114,7 @@ class FullVertexPairCoarsener final : public ICoarsener,
       ASSERT(!invalid_hypernodes[rep_node], V(rep_node));
       ASSERT(!invalid_hypernodes[contracted_node], V(contracted_node));
 
-      performContraction(rep_node, contracted_node);
+      Base::performContraction(rep_node, contracted_node);
 
       ASSERT(_pq.contains(contracted_node), V(contracted_node));
       _pq.remove(contracted_node);
@@ -123,21 +129,28 @@ class FullVertexPairCoarsener final : public ICoarsener,
   }
 
   bool uncoarsenImpl(IRefiner& refiner) override final {
-    return doUncoarsen(refiner);
+    return Base::doUncoarsen(refiner);
   }
 
   void reRateAffectedHypernodes(const HypernodeID rep_node,
                                 ds::FastResetFlagArray<>& rerated_hypernodes,
                                 ds::FastResetFlagArray<>& invalid_hypernodes) {
+    // Collect all affected hypernodes first and then re-rate them in one pass.
+    // This way each hypernode is rated at most once per contraction and the PQ
+    // updates are not interleaved with the scans over the (possibly large) nets
+    // incident to rep_node.
+    _affected_hypernodes.clear();
     for (const HyperedgeID& he : _hg.incidentEdges(rep_node)) {
       for (const HypernodeID& pin : _hg.pins(he)) {
         if (!rerated_hypernodes[pin] && !invalid_hypernodes[pin]) {
-          const Rating rating = _rater.rate(pin);
           rerated_hypernodes.set(pin, true);
-          updatePQandContractionTarget(pin, rating, invalid_hypernodes);
+          _affected_hypernodes.push_back(pin);
         }
       }
     }
+    for (const HypernodeID& hn : _affected_hypernodes) {
+      updatePQandContractionTarget(hn, _rater.rate(hn), invalid_hypernodes);
+    }
     rerated_hypernodes.reset();
   }
 
@@ -171,5 +184,6 @@ class FullVertexPairCoarsener final : public ICoarsener,
   using Base::_hypergraph_pruner;
   Rater _rater;
   std::vector<HypernodeID> _target;
+  std::vector<HypernodeID> _affected_hypernodes;
 };
 }  // namespace kahypar
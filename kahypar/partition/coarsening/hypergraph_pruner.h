@@ -28,6 +28,7 @@
 #include "kahypar/datastructure/fast_reset_flag_array.h"
 #include "kahypar/definitions.h"
 #include "kahypar/partition/coarsening/coarsening_memento.h"
+#include "kahypar/utils/counters.h"
 #include "kahypar/utils/math.h"
 #include "kahypar/utils/stats.h"
 
@@ -212,6 +213,7 @@ class HypergraphPruner {
       } (), "parallel HE removal failed");
 
 
+    KAHYPAR_COUNT(parallel_nets_removed, removed_parallel_hes);
     return removed_parallel_hes;
   }
 
@@ -280,6 +282,13 @@ class HypergraphPruner {
     return _max_removed_single_node_he_weight;
   }
 
+  size_t sizeInBytes() const {
+    return _removed_single_node_hyperedges.capacity() * sizeof(HyperedgeID) +
+           _removed_parallel_hyperedges.capacity() * sizeof(ParallelHE) +
+           _fingerprints.capacity() * sizeof(Fingerprint) +
+           _contained_hypernodes.sizeInBytes();
+  }
+
  private:
   HyperedgeWeight _max_removed_single_node_he_weight;
   std::vector<HyperedgeID> _removed_single_node_hyperedges;
@@ -32,6 +32,7 @@
 #include "kahypar/partition/coarsening/policies/rating_community_policy.h"
 #include "kahypar/partition/coarsening/policies/rating_heavy_node_penalty_policy.h"
 #include "kahypar/partition/coarsening/policies/rating_partition_policy.h"
+#include "kahypar/partition/coarsening/policies/rating_queue_policy.h"
 #include "kahypar/partition/coarsening/policies/rating_score_policy.h"
 #include "kahypar/partition/coarsening/policies/rating_tie_breaking_policy.h"
 #include "kahypar/partition/coarsening/vertex_pair_coarsener_base.h"
@@ -44,9 +45,12 @@ template <class ScorePolicy = HeavyEdgeScore,
           class RatingPartitionPolicy = NormalPartitionPolicy,
           class AcceptancePolicy = BestRatingWithTieBreaking<>,
           class FixedVertexPolicy = AllowFreeOnFixedFreeOnFreeFixedOnFixed,
-          typename RatingType = RatingType>
+          typename RatingType = RatingType,
+          class RatingQueuePolicy = BinaryHeapRatingQueue>
 class LazyVertexPairCoarsener final : public ICoarsener,
-                                      private VertexPairCoarsenerBase<>{
+                                      private VertexPairCoarsenerBase<
+                                        typename RatingQueuePolicy::template PriorityQueue<
+                                          HypernodeID, RatingType> >{
  private:
   static constexpr bool debug = false;
 
@@ -57,7 +61,8 @@ class LazyVertexPairCoarsener final : public ICoarsener,
                                 AcceptancePolicy,
                                 FixedVertexPolicy,
                                 RatingType>;
-  using Base = VertexPairCoarsenerBase;
+  using Base = VertexPairCoarsenerBase<
+    typename RatingQueuePolicy::template PriorityQueue<HypernodeID, RatingType> >;
   using Rating = typename Rater::Rating;
 
  public:
@@ -84,7 +89,7 @@ class LazyVertexPairCoarsener final : public ICoarsener,
 
     Base::rateAllHypernodes(_rater, _target);
 
-    while (!_pq.empty() && _hg.currentNumNodes() > limit) {
+    while (!_pq.empty() && _hg.currentNumNodes() > limit && !_context.isCancelled()) {
       const HypernodeID rep_node = _pq.top();
 
       if (_outdated_rating[rep_node]) {
@@ -35,6 +35,7 @@
 #include "kahypar/partition/coarsening/policies/rating_score_policy.h"
 #include "kahypar/partition/coarsening/policies/rating_tie_breaking_policy.h"
 #include "kahypar/partition/coarsening/vertex_pair_rater.h"
+#include "kahypar/utils/trace.h"
 
 namespace kahypar {
 template <class ScorePolicy = HeavyEdgeScore,
@@ -79,10 +80,12 @@ class MLCoarsener final : public ICoarsener,
   void coarsenImpl(const HypernodeID limit) override final {
     int pass_nr = 0;
     std::vector<HypernodeID> current_hns;
-    while (_hg.currentNumNodes() > limit) {
+    while (_hg.currentNumNodes() > limit && !_context.isCancelled()) {
       DBG << V(pass_nr);
       DBG << V(_hg.currentNumNodes());
       DBG << V(_hg.currentNumEdges());
+      TraceSpan span(_context.partition.trace_recorder, "coarsening_pass", "coarsening");
+      span.arg("pass", pass_nr).arg("nodes", _hg.currentNumNodes());
       _rater.resetMatches();
       current_hns.clear();
       const HypernodeID num_hns_before_pass = _hg.currentNumNodes();
@@ -111,7 +114,7 @@ class MLCoarsener final : public ICoarsener,
             // }
           }
 
-          if (_hg.currentNumNodes() <= limit) {
+          if (_hg.currentNumNodes() <= limit || _context.isCancelled()) {
             break;
           }
         }
@@ -0,0 +1,46 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2019 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include "kahypar/datastructure/binary_heap.h"
+#include "kahypar/datastructure/quantized_bucket_queue.h"
+#include "kahypar/meta/policy_registry.h"
+#include "kahypar/meta/typelist.h"
+
+namespace kahypar {
+// Exact ordering of vertex pair ratings.
+class BinaryHeapRatingQueue final : public meta::PolicyBase {
+ public:
+  template <typename IDType, typename KeyType>
+  using PriorityQueue = ds::BinaryMaxHeap<IDType, KeyType>;
+};
+
+// Constant time key updates. The top element is only guaranteed to be within a
+// relative error of 2^-8 of the best rating.
+class QuantizedBucketRatingQueue final : public meta::PolicyBase {
+ public:
+  template <typename IDType, typename KeyType>
+  using PriorityQueue = ds::QuantizedBucketMaxQueue<IDType, KeyType>;
+};
+
+using RatingQueuePolicies = meta::Typelist<BinaryHeapRatingQueue,
+                                           QuantizedBucketRatingQueue>;
+}  // namespace kahypar
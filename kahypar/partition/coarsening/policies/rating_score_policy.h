@@ -24,6 +24,7 @@
 #include "kahypar/meta/policy_registry.h"
 #include "kahypar/meta/typelist.h"
 #include "kahypar/partition/context.h"
+#include "kahypar/partition/evolutionary/edge_frequency.h"
 
 namespace kahypar {
 class HeavyEdgeScore final : public meta::PolicyBase {
@@ -41,7 +42,7 @@ class EdgeFrequencyScore final : public meta::PolicyBase {
                                                                  const HyperedgeID he,
                                                                  const Context& context) {
     return static_cast<RatingType>(exp(-context.evolutionary.gamma *
-                                       context.evolutionary.edge_frequency[he]) /
+                                       (*context.evolutionary.edge_frequency)[he]) /
                                    hypergraph.edgeSize(he));
   }
 };
@@ -0,0 +1,121 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2019 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <limits>
+#include <vector>
+
+#include "kahypar/datastructure/fast_reset_flag_array.h"
+#include "kahypar/definitions.h"
+#include "kahypar/macros.h"
+
+namespace kahypar {
+/*!
+ * Caches the initial ratings of the input hypergraph across consecutive coarsening
+ * passes (i.e. V-cycles and evolutionary mutations).
+ *
+ * If contractions are restricted to the current partition, the rating of a hypernode
+ * only depends on static data (weights, fixed vertices) and on the block and community
+ * ids of the hypernode itself and its neighbors. Therefore, before each pass we compare
+ * the current partition and community structure with the ones of the last pass and only
+ * drop the cached ratings of hypernodes that changed and of their neighbors.
+ */
+class RatingCache {
+ public:
+  struct Entry {
+    HypernodeID target;
+    RatingType value;
+    bool valid;
+  };
+
+  RatingCache() :
+    _hypergraph(nullptr),
+    _threshold_node_weight(0),
+    _part(),
+    _community(),
+    _cached(),
+    _entries() { }
+
+  RatingCache(const RatingCache&) = delete;
+  RatingCache& operator= (const RatingCache&) = delete;
+
+  RatingCache(RatingCache&&) = default;
+  RatingCache& operator= (RatingCache&&) = default;
+
+  ~RatingCache() = default;
+
+  // Has to be called on the uncoarsened hypergraph before cached ratings are accessed.
+  // Ratings are only reused if the same hypergraph is coarsened with the same weight
+  // threshold again.
+  void prepare(const Hypergraph& hypergraph, const HypernodeWeight threshold_node_weight) {
+    if (_hypergraph != &hypergraph ||
+        _part.size() != hypergraph.initialNumNodes() ||
+        _threshold_node_weight != threshold_node_weight) {
+      _hypergraph = &hypergraph;
+      _threshold_node_weight = threshold_node_weight;
+      _part.assign(hypergraph.initialNumNodes(), Hypergraph::kInvalidPartition);
+      _community.assign(hypergraph.initialNumNodes(), Hypergraph::kInvalidPartition);
+      _entries.resize(hypergraph.initialNumNodes());
+      _cached = ds::FastResetFlagArray<>(hypergraph.initialNumNodes());
+    }
+    invalidateChangedNeighborhoods(hypergraph);
+  }
+
+  bool contains(const HypernodeID hn) const {
+    return _cached[hn];
+  }
+
+  const Entry & get(const HypernodeID hn) const {
+    ASSERT(contains(hn), V(hn));
+    return _entries[hn];
+  }
+
+  void set(const HypernodeID hn, const HypernodeID target,
+           const RatingType value, const bool valid) {
+    _entries[hn] = { target, value, valid };
+    _cached.set(hn, true);
+  }
+
+ private:
+  void invalidateChangedNeighborhoods(const Hypergraph& hypergraph) {
+    for (const HypernodeID& hn : hypergraph.nodes()) {
+      if (hypergraph.partID(hn) != _part[hn] ||
+          hypergraph.communities()[hn] != _community[hn]) {
+        _part[hn] = hypergraph.partID(hn);
+        _community[hn] = hypergraph.communities()[hn];
+        _cached.set(hn, false);
+        for (const HyperedgeID& he : hypergraph.incidentEdges(hn)) {
+          for (const HypernodeID& pin : hypergraph.pins(he)) {
+            _cached.set(pin, false);
+          }
+        }
+      }
+    }
+  }
+
+  const Hypergraph* _hypergraph;
+  HypernodeWeight _threshold_node_weight;
+  std::vector<PartitionID> _part;
+  std::vector<PartitionID> _community;
+  ds::FastResetFlagArray<> _cached;
+  std::vector<Entry> _entries;
+};
+}  // namespace kahypar
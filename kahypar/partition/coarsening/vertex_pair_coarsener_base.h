@@ -31,11 +31,13 @@
 #include "kahypar/definitions.h"
 #include "kahypar/meta/int_to_type.h"
 #include "kahypar/partition/coarsening/coarsener_base.h"
+#include "kahypar/partition/coarsening/rating_cache.h"
 #include "kahypar/partition/coarsening/vertex_pair_rater.h"
 #include "kahypar/partition/context.h"
 #include "kahypar/partition/metrics.h"
 #include "kahypar/partition/refinement/i_refiner.h"
 #include "kahypar/utils/randomize.h"
+#include "kahypar/utils/trace.h"
 
 namespace kahypar {
 template <class PrioQueue = ds::BinaryMaxHeap<HypernodeID, RatingType> >
@@ -90,6 +92,11 @@ class VertexPairCoarsenerBase : public CoarsenerBase {
     UncontractionGainChanges changes;
     changes.representative.push_back(0);
     changes.contraction_partner.push_back(0);
+    // In the timeline, uncontractions are grouped into batches
+    // that (at least) double the number of nodes.
+    TraceSpan batch_span(_context.partition.trace_recorder, "uncoarsening_batch", "local_search");
+    HypernodeID batch_num_nodes = _hg.currentNumNodes();
+    batch_span.arg("nodes", batch_num_nodes);
     while (!_history.empty()) {
       CoarsenerBase::restoreParallelHyperedges();
       CoarsenerBase::restoreSingleNodeHyperedges();
@@ -113,11 +120,23 @@ class VertexPairCoarsenerBase : public CoarsenerBase {
         _hg.uncontract(_history.back().contraction_memento);
       }
 
-      CoarsenerBase::performLocalSearch(refiner, refinement_nodes, current_metrics, changes);
+      // After cancellation, the partition is only projected onto the input hypergraph.
+      if (!_context.isCancelled()) {
+        CoarsenerBase::performLocalSearch(refiner, refinement_nodes, current_metrics, changes);
+      }
       changes.representative[0] = 0;
       changes.contraction_partner[0] = 0;
       _history.pop_back();
+
+      if (_hg.currentNumNodes() >= 2 * batch_num_nodes && !_history.empty()) {
+        batch_span.arg("end_nodes", _hg.currentNumNodes());
+        batch_span.restart();
+        batch_num_nodes = _hg.currentNumNodes();
+        batch_span.arg("nodes", batch_num_nodes);
+      }
     }
+    batch_span.arg("end_nodes", _hg.currentNumNodes());
+    batch_span.end();
 
     // This currently cannot be guaranteed for RB-partitioning and k != 2^x, since it might be
     // possible that 2FM cannot re-adjust the part weights to be less than Lmax0 and Lmax1.
@@ -159,8 +178,20 @@ class VertexPairCoarsenerBase : public CoarsenerBase {
                          std::vector<HypernodeID>& target) {
     std::vector<HypernodeID> permutation;
     createHypernodePermutation(permutation);
+    RatingCache* cache = ratingCache(rater);
     for (const HypernodeID hn : permutation) {
+      if (cache != nullptr && cache->contains(hn)) {
+        const RatingCache::Entry& entry = cache->get(hn);
+        if (entry.valid) {
+          _pq.push(hn, entry.value);
+          target[hn] = entry.target;
+        }
+        continue;
+      }
       const typename Rater::Rating rating = rater.rate(hn);
+      if (cache != nullptr) {
+        cache->set(hn, rating.target, rating.value, rating.valid);
+      }
       if (rating.valid) {
         _pq.push(hn, rating.value);
         target[hn] = rating.target;
@@ -168,6 +199,26 @@ class VertexPairCoarsenerBase : public CoarsenerBase {
     }
   }
 
+  // Initial ratings can only be reused if they solely depend on the current partition
+  // of the input hypergraph. This rules out the edge frequency based ratings and the
+  // evolutionary partition policy used during combine operations.
+  template <typename Rater>
+  RatingCache* ratingCache(const Rater& rater) {
+    if (!_context.coarsening.reuse_ratings ||
+        _context.coarsening.rating_cache == nullptr ||
+        _context.type != ContextType::main ||
+        _context.partition.mode != Mode::direct_kway ||
+        _context.preprocessing.min_hash_sparsifier.is_active ||
+        _context.coarsening.rating.partition_policy != RatingPartitionPolicy::normal ||
+        _context.coarsening.rating.rating_function != RatingFunction::heavy_edge ||
+        _context.coarsening.rating.heavy_node_penalty_policy ==
+        HeavyNodePenaltyPolicy::edge_frequency_penalty) {
+      return nullptr;
+    }
+    _context.coarsening.rating_cache->prepare(_hg, rater.thresholdNodeWeight());
+    return _context.coarsening.rating_cache.get();
+  }
+
   void createHypernodePermutation(std::vector<HypernodeID>& permutation) {
     permutation.reserve(_hg.initialNumNodes());
     for (const HypernodeID& hn : _hg.nodes()) {
@@ -37,6 +37,7 @@
 #include "kahypar/partition/coarsening/policies/rating_score_policy.h"
 #include "kahypar/partition/coarsening/policies/rating_tie_breaking_policy.h"
 #include "kahypar/partition/context.h"
+#include "kahypar/utils/counters.h"
 
 namespace kahypar {
 template <class ScorePolicy = HeavyEdgeScore,
@@ -94,10 +95,12 @@ class VertexPairRater {
 
   VertexPairRating rate(const HypernodeID u) {
     DBG << "Calculating rating for HN" << u;
+    KAHYPAR_COUNT(rating_calls, 1);
     const HypernodeWeight weight_u = _hg.nodeWeight(u);
     for (const HyperedgeID& he : _hg.incidentEdges(u)) {
       ASSERT(_hg.edgeSize(he) > 1, V(he));
       if (_hg.edgeSize(he) <= _context.partition.hyperedge_size_threshold) {
+        KAHYPAR_COUNT(pins_visited, _hg.edgeSize(he));
         const RatingType score = ScorePolicy::score(_hg, he, _context);
         for (const HypernodeID& v : _hg.pins(he)) {
           if (v != u && belowThresholdNodeWeight(weight_u, _hg.nodeWeight(v)) &&
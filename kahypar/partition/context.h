@@ -25,13 +25,17 @@
 #include <cstdint>
 #include <iomanip>
 #include <limits>
+#include <memory>
 #include <sstream>
 #include <string>
 #include <vector>
 
 #include "kahypar/definitions.h"
+#include "kahypar/partition/coarsening/rating_cache.h"
 #include "kahypar/partition/context_enum_classes.h"
 #include "kahypar/partition/evolutionary/action.h"
+#include "kahypar/partition/initial_partitioning/initial_partitioning_race.h"
+#include "kahypar/partition/partitioning_control.h"
 #include "kahypar/utils/stats.h"
 
 namespace kahypar {
@@ -49,8 +53,10 @@ struct CommunityDetection {
   bool enable_in_initial_partitioning = false;
   bool reuse_communities = false;
   LouvainEdgeWeight edge_weight = LouvainEdgeWeight::UNDEFINED;
+  LouvainEdgeWeightPrecision edge_weight_precision = LouvainEdgeWeightPrecision::long_double;
   uint32_t max_pass_iterations = std::numeric_limits<uint32_t>::max();
   long double min_eps_improvement = std::numeric_limits<long double>::max();
+  size_t num_threads = 1;
 };
 
 struct PreprocessingParameters {
@@ -59,6 +65,8 @@ struct PreprocessingParameters {
   bool enable_deduplication = false;
   MinHashSparsifierParameters min_hash_sparsifier = MinHashSparsifierParameters();
   CommunityDetection community_detection = CommunityDetection();
+  std::string cache_read_filename { };
+  std::string cache_write_filename { };
 };
 
 inline std::ostream& operator<< (std::ostream& str, const MinHashSparsifierParameters& params) {
@@ -90,6 +98,10 @@ inline std::ostream& operator<< (std::ostream& str, const CommunityDetection& pa
       << params.min_eps_improvement << std::endl;
   str << "  graph edge weight:                  "
       << params.edge_weight << std::endl;
+  str << "  graph edge weight precision:        "
+      << params.edge_weight_precision << std::endl;
+  str << "  number of threads:                  "
+      << params.num_threads << std::endl;
   str << "  reuse community structure:          " << std::boolalpha
       << params.reuse_communities << std::endl;
   return str;
@@ -104,6 +116,12 @@ inline std::ostream& operator<< (std::ostream& str, const PreprocessingParameter
       << params.enable_min_hash_sparsifier << std::endl;
   str << "  enable community detection:         " << std::boolalpha
       << params.enable_community_detection << std::endl;
+  if (!params.cache_read_filename.empty()) {
+    str << "  read cache from:                    " << params.cache_read_filename << std::endl;
+  }
+  if (!params.cache_write_filename.empty()) {
+    str << "  write cache to:                     " << params.cache_write_filename << std::endl;
+  }
   if (params.enable_min_hash_sparsifier) {
     str << "-------------------------------------------------------------------------------"
         << std::endl;
@@ -124,6 +142,7 @@ struct RatingParameters {
   HeavyNodePenaltyPolicy heavy_node_penalty_policy = HeavyNodePenaltyPolicy::UNDEFINED;
   AcceptancePolicy acceptance_policy = AcceptancePolicy::UNDEFINED;
   RatingPartitionPolicy partition_policy = RatingPartitionPolicy::normal;
+  RatingQueue queue = RatingQueue::binary_heap;
   FixVertexContractionAcceptancePolicy fixed_vertex_acceptance_policy =
     FixVertexContractionAcceptancePolicy::UNDEFINED;
 };
@@ -136,6 +155,7 @@ inline std::ostream& operator<< (std::ostream& str, const RatingParameters& para
   str << "    Acceptance Policy:                " << params.acceptance_policy << std::endl;
   str << "    Partition Policy:                 " << params.partition_policy << std::endl;
   str << "    Fixed Vertex Acceptance Policy:   " << params.fixed_vertex_acceptance_policy << std::endl;
+  str << "    Priority Queue:                   " << params.queue << std::endl;
   return str;
 }
 
@@ -145,6 +165,11 @@ struct CoarseningParameters {
   RatingParameters rating = { };
   HypernodeID contraction_limit_multiplier = std::numeric_limits<HypernodeID>::max();
   double max_allowed_weight_multiplier = std::numeric_limits<double>::max();
+  bool reuse_ratings = false;
+
+  // Shared by all copies of the context, such that V-cycles and evolutionary
+  // mutations on the same hypergraph can reuse the initial ratings.
+  mutable std::shared_ptr<RatingCache> rating_cache = nullptr;
 
   // Those will be determined dynamically
   HypernodeWeight max_allowed_node_weight = 0;
@@ -157,6 +182,8 @@ inline std::ostream& operator<< (std::ostream& str, const CoarseningParameters&
   str << "  Algorithm:                          " << params.algorithm << std::endl;
   str << "  max-allowed-weight-multiplier:      " << params.max_allowed_weight_multiplier << std::endl;
   str << "  contraction-limit-multiplier:       " << params.contraction_limit_multiplier << std::endl;
+  str << "  reuse ratings:                      " << std::boolalpha
+      << params.reuse_ratings << std::endl;
   str << "  hypernode weight fraction:          ";
   // For the coarsening algorithm of the initial partitioning phase
   // these parameters are only known after main coarsening.
@@ -185,8 +212,10 @@ inline std::ostream& operator<< (std::ostream& str, const CoarseningParameters&
 
 struct LocalSearchParameters {
   struct FM {
-    uint32_t max_number_of_fruitless_moves = std::numeric_limits<uint32_t>::max();
-    double adaptive_stopping_alpha = std::numeric_limits<double>::max();
+    // The stopping parameters and the flow alpha are scaled down in deadline mode
+    // (see TimeBudget).
+    mutable uint32_t max_number_of_fruitless_moves = std::numeric_limits<uint32_t>::max();
+    mutable double adaptive_stopping_alpha = std::numeric_limits<double>::max();
     RefinementStoppingRule stopping_rule = RefinementStoppingRule::UNDEFINED;
   };
 
@@ -194,7 +223,7 @@ struct LocalSearchParameters {
     FlowAlgorithm algorithm = FlowAlgorithm::UNDEFINED;
     FlowNetworkType network = FlowNetworkType::UNDEFINED;
     FlowExecutionMode execution_policy = FlowExecutionMode::UNDEFINED;
-    double alpha = std::numeric_limits<double>::max();
+    mutable double alpha = std::numeric_limits<double>::max();
     size_t beta = std::numeric_limits<size_t>::max();
     bool use_most_balanced_minimum_cut = false;
     bool use_adaptive_alpha_stopping_rule = false;
@@ -260,6 +289,13 @@ struct InitialPartitioningParameters {
   CoarseningParameters coarsening = { };
   LocalSearchParameters local_search = { };
   uint32_t nruns = std::numeric_limits<uint32_t>::max();
+  size_t num_threads = 1;
+  GainQueue gain_queue = GainQueue::binary_heap;
+  bool racing = false;
+  double racing_margin = 0.25;
+  uint32_t racing_patience = 5;
+  // Shared by all initial partitioning calls of a partitioning run, if racing is enabled.
+  mutable std::shared_ptr<InitialPartitioningRace> race = nullptr;
 
   // The following parameters are only used internally and are not supposed to
   // be changed by the user.
@@ -286,6 +322,14 @@ inline std::ostream& operator<< (std::ostream& str, const InitialPartitioningPar
       << std::endl;
   str << "Initial Partitioning Parameters:" << std::endl;
   str << "  # IP trials:                        " << params.nruns << std::endl;
+  str << "  # IP threads:                       " << params.num_threads << std::endl;
+  str << "  GHG gain queue:                     " << params.gain_queue << std::endl;
+  str << "  racing:                             " << std::boolalpha
+      << params.racing << std::endl;
+  if (params.racing) {
+    str << "  racing margin:                      " << params.racing_margin << std::endl;
+    str << "  racing patience:                    " << params.racing_patience << std::endl;
+  }
   str << "  Mode:                               " << params.mode << std::endl;
   str << "  Technique:                          " << params.technique << std::endl;
   str << "  Algorithm:                          " << params.algo << std::endl;
@@ -300,6 +344,9 @@ inline std::ostream& operator<< (std::ostream& str, const InitialPartitioningPar
   return str;
 }
 
+class TimeBudget;
+class TraceRecorder;
+
 struct PartitioningParameters {
   Mode mode = Mode::UNDEFINED;
   Objective objective = Objective::UNDEFINED;
@@ -310,8 +357,16 @@ struct PartitioningParameters {
   int seed = 0;
   uint32_t global_search_iterations = std::numeric_limits<uint32_t>::max();
   int time_limit = 0;
+  // anytime mode: return the best partition found within the given number of seconds
+  double deadline = 0.0;
 
   mutable uint32_t current_v_cycle = 0;
+  // progress callback and cancellation (library interface)
+  mutable std::shared_ptr<PartitioningControl> control = nullptr;
+  // Adapts the effort of the phases to the deadline (see TimeBudget).
+  mutable std::shared_ptr<TimeBudget> time_budget = nullptr;
+  // Timeline of the current partitioning call, if a trace file is given (see TraceRecorder).
+  mutable std::shared_ptr<TraceRecorder> trace_recorder = nullptr;
   std::vector<HypernodeWeight> perfect_balance_part_weights;
   std::vector<HypernodeWeight> max_part_weights;
   HyperedgeID hyperedge_size_threshold = std::numeric_limits<HypernodeID>::max();
@@ -327,6 +382,7 @@ struct PartitioningParameters {
   std::string graph_partition_filename { };
   std::string fixed_vertex_filename { };
   std::string input_partition_filename { };
+  std::string trace_filename { };
 };
 
 inline std::ostream& operator<< (std::ostream& str, const PartitioningParameters& params) {
@@ -339,6 +395,9 @@ inline std::ostream& operator<< (std::ostream& str, const PartitioningParameters
   if (!params.input_partition_filename.empty()) {
     str << "  Input Partition File:                  " << params.input_partition_filename << std::endl;
   }
+  if (!params.trace_filename.empty()) {
+    str << "  Trace File:                         " << params.trace_filename << std::endl;
+  }
   str << "  Mode:                               " << params.mode << std::endl;
   str << "  Objective:                          " << params.objective << std::endl;
   str << "  k:                                  " << params.k << std::endl;
@@ -346,6 +405,9 @@ inline std::ostream& operator<< (std::ostream& str, const PartitioningParameters
   str << "  seed:                               " << params.seed << std::endl;
   str << "  # V-cycles:                         " << params.global_search_iterations << std::endl;
   str << "  time limit:                         " << params.time_limit << "s" << std::endl;
+  if (params.deadline > 0) {
+    str << "  deadline:                           " << params.deadline << "s" << std::endl;
+  }
   str << "  hyperedge size threshold:           " << params.hyperedge_size_threshold << std::endl;
   str << "  use individual block weights:       " << std::boolalpha
       << params.use_individual_part_weights << std::endl;
@@ -369,6 +431,8 @@ inline std::ostream& operator<< (std::ostream& str, const PartitioningParameters
   }
   return str;
 }
+class EdgeFrequency;
+
 struct EvolutionaryParameters {
   size_t population_size;
   float mutation_chance;
@@ -386,10 +450,27 @@ struct EvolutionaryParameters {
   mutable Action action;
   const std::vector<PartitionID>* parent1 = nullptr;
   const std::vector<PartitionID>* parent2 = nullptr;
-  mutable std::vector<size_t> edge_frequency;
+  // Resident edge frequencies of the edge frequency combine operator (see EdgeFrequency).
+  mutable std::shared_ptr<EdgeFrequency> edge_frequency = nullptr;
+  size_t edge_frequency_num_threads = 1;
   mutable std::vector<ClusterID> communities;
   bool unlimited_coarsening_contraction;
   bool random_vcycles;
+  // Island model: each island evolves its own population in its own thread
+  // and periodically sends its best individuals to the next island.
+  size_t num_islands = 1;
+  int migration_interval = 10;
+  size_t num_migrants = 1;
+  // Multiple processes exchange migrants via files in the migration directory
+  // (in-process exchange if empty). The islands of all processes form one ring.
+  std::string migration_directory = "";
+  size_t num_processes = 1;
+  size_t process_id = 0;
+  // Periodic checkpoints of the population (disabled if empty). With multiple
+  // islands, each island uses its own file with the island id as suffix.
+  std::string checkpoint_filename = "";
+  int checkpoint_interval = 300;  // seconds
+  bool resume = false;
 };
 
 inline std::ostream& operator<< (std::ostream& str, const EvolutionaryParameters& params) {
@@ -397,10 +478,29 @@ inline std::ostream& operator<< (std::ostream& str, const EvolutionaryParameters
   str << "  Population Size:                    " << params.population_size << std::endl;
   str << "  Mutation Chance                     " << params.mutation_chance << std::endl;
   str << "  Edge Frequency Chance               " << params.edge_frequency_chance << std::endl;
+  str << "  Edge Frequency Threads              " << params.edge_frequency_num_threads
+      << std::endl;
   str << "  Replace Strategy                    " << params.replace_strategy << std::endl;
   str << "  Combine Strategy                    " << params.combine_strategy << std::endl;
   str << "  Mutation Strategy                   " << params.mutate_strategy << std::endl;
   str << "  Diversification Interval            " << params.diversify_interval << std::endl;
+  str << "  Number of Islands                   " << params.num_islands << std::endl;
+  if (params.num_islands > 1 || !params.migration_directory.empty()) {
+    str << "  Migration Interval                  " << params.migration_interval << std::endl;
+    str << "  Number of Migrants                  " << params.num_migrants << std::endl;
+  }
+  if (!params.migration_directory.empty()) {
+    str << "  Migration Directory                 " << params.migration_directory << std::endl;
+    str << "  Process                             " << params.process_id << " of "
+        << params.num_processes << std::endl;
+  }
+  if (!params.checkpoint_filename.empty()) {
+    str << "  Checkpoint File                     " << params.checkpoint_filename << std::endl;
+    str << "  Checkpoint Interval                 " << params.checkpoint_interval << "s"
+        << std::endl;
+    str << "  Resume from Checkpoint              " << std::boolalpha << params.resume
+        << std::endl;
+  }
   return str;
 }
 
@@ -444,6 +544,19 @@ class Context {
     return evolutionary.communities;
   }
 
+  bool isCancelled() const {
+    return partition.control != nullptr && partition.control->isCancelled();
+  }
+
+  // Only the top-level partitioner reports its progress. In evolutionary mode,
+  // the progress of the individual partitioning calls is not reported.
+  void reportProgress(const ProgressPhase phase, const HyperedgeWeight objective = -1,
+                      const double imbalance = -1.0) const {
+    if (partition.control != nullptr && type == ContextType::main && !partition_evolutionary) {
+      partition.control->report(phase, objective, imbalance);
+    }
+  }
+
   void setupPartWeights(const HypernodeWeight total_hypergraph_weight) {
     if (partition.use_individual_part_weights) {
       partition.perfect_balance_part_weights = partition.max_part_weights;
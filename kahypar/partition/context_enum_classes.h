@@ -71,6 +71,18 @@ enum class RatingPartitionPolicy : uint8_t {
   evolutionary
 };
 
+enum class RatingQueue : uint8_t {
+  binary_heap,
+  quantized_bucket,
+  UNDEFINED
+};
+
+enum class GainQueue : uint8_t {
+  binary_heap,
+  integer_bucket,
+  UNDEFINED
+};
+
 enum class FixVertexContractionAcceptancePolicy : uint8_t {
   free_vertex_only,
   fixed_vertex_allowed,
@@ -124,6 +136,13 @@ enum class LouvainEdgeWeight : uint8_t {
   UNDEFINED
 };
 
+enum class LouvainEdgeWeightPrecision : uint8_t {
+  long_double,
+  double_precision,
+  single_precision,
+  UNDEFINED
+};
+
 enum class RefinementStoppingRule : uint8_t {
   simple,
   adaptive_opt,
@@ -229,6 +248,26 @@ static std::ostream& operator<< (std::ostream& os, const RatingPartitionPolicy&
   return os << static_cast<uint8_t>(policy);
 }
 
+static std::ostream& operator<< (std::ostream& os, const RatingQueue& queue) {
+  switch (queue) {
+    case RatingQueue::binary_heap: return os << "binary_heap";
+    case RatingQueue::quantized_bucket: return os << "quantized_bucket";
+    case RatingQueue::UNDEFINED: return os << "UNDEFINED";
+      // omit default case to trigger compiler warning for missing cases
+  }
+  return os << static_cast<uint8_t>(queue);
+}
+
+static std::ostream& operator<< (std::ostream& os, const GainQueue& queue) {
+  switch (queue) {
+    case GainQueue::binary_heap: return os << "binary_heap";
+    case GainQueue::integer_bucket: return os << "integer_bucket";
+    case GainQueue::UNDEFINED: return os << "UNDEFINED";
+      // omit default case to trigger compiler warning for missing cases
+  }
+  return os << static_cast<uint8_t>(queue);
+}
+
 static std::ostream& operator<< (std::ostream& os, const Mode& mode) {
   switch (mode) {
     case Mode::recursive_bisection: return os << "recursive";
@@ -381,6 +420,17 @@ static std::ostream& operator<< (std::ostream& os, const LouvainEdgeWeight& weig
   return os << static_cast<uint8_t>(weight);
 }
 
+static std::ostream& operator<< (std::ostream& os, const LouvainEdgeWeightPrecision& precision) {
+  switch (precision) {
+    case LouvainEdgeWeightPrecision::long_double: return os << "long_double";
+    case LouvainEdgeWeightPrecision::double_precision: return os << "double";
+    case LouvainEdgeWeightPrecision::single_precision: return os << "float";
+    case LouvainEdgeWeightPrecision::UNDEFINED: return os << "UNDEFINED";
+      // omit default case to trigger compiler warning for missing cases
+  }
+  return os << static_cast<uint8_t>(precision);
+}
+
 static std::ostream& operator<< (std::ostream& os, const RefinementStoppingRule& rule) {
   switch (rule) {
     case RefinementStoppingRule::simple: return os << "simple";
@@ -472,6 +522,28 @@ static RatingPartitionPolicy ratingPartitionPolicyFromString(const std::string&
   return RatingPartitionPolicy::normal;
 }
 
+static RatingQueue ratingQueueFromString(const std::string& queue) {
+  if (queue == "binary_heap") {
+    return RatingQueue::binary_heap;
+  } else if (queue == "quantized_bucket") {
+    return RatingQueue::quantized_bucket;
+  }
+  LOG << "No valid priority queue for rating.";
+  exit(0);
+  return RatingQueue::binary_heap;
+}
+
+static GainQueue gainQueueFromString(const std::string& queue) {
+  if (queue == "binary_heap") {
+    return GainQueue::binary_heap;
+  } else if (queue == "integer_bucket") {
+    return GainQueue::integer_bucket;
+  }
+  LOG << "No valid priority queue for initial partitioning gains.";
+  exit(0);
+  return GainQueue::binary_heap;
+}
+
 static FixVertexContractionAcceptancePolicy fixedVertexAcceptanceCriterionFromString(const std::string& crit) {
   if (crit == "free_vertex_only") {
     return FixVertexContractionAcceptancePolicy::free_vertex_only;
@@ -619,6 +691,19 @@ static LouvainEdgeWeight edgeWeightFromString(const std::string& type) {
   return LouvainEdgeWeight::uniform;
 }
 
+static LouvainEdgeWeightPrecision edgeWeightPrecisionFromString(const std::string& precision) {
+  if (precision == "long_double") {
+    return LouvainEdgeWeightPrecision::long_double;
+  } else if (precision == "double") {
+    return LouvainEdgeWeightPrecision::double_precision;
+  } else if (precision == "float") {
+    return LouvainEdgeWeightPrecision::single_precision;
+  }
+  LOG << "Illegal option:" << precision;
+  exit(0);
+  return LouvainEdgeWeightPrecision::long_double;
+}
+
 static Mode modeFromString(const std::string& mode) {
   if (mode == "recursive") {
     return Mode::recursive_bisection;
@@ -21,15 +21,19 @@
 #pragma once
 
 #include <limits>
+#include <memory>
 
 #include "kahypar/definitions.h"
 #include "kahypar/partition/coarsening/hypergraph_pruner.h"
 #include "kahypar/partition/coarsening/i_coarsener.h"
+#include "kahypar/partition/coarsening/rating_cache.h"
 #include "kahypar/partition/context.h"
 #include "kahypar/partition/factories.h"
 #include "kahypar/partition/metrics.h"
 #include "kahypar/partition/multilevel.h"
 #include "kahypar/partition/refinement/i_refiner.h"
+#include "kahypar/partition/time_budget.h"
+#include "kahypar/utils/trace.h"
 
 namespace kahypar {
 namespace direct_kway {
@@ -44,11 +48,21 @@ static inline bool partitionVCycle(Hypergraph& hypergraph, ICoarsener& coarsener
   io::printVcycleBanner(context);
   io::printCoarseningBanner(context);
 
+  TraceSpan coarsening_span(context.partition.trace_recorder, "coarsening", "coarsening");
+  coarsening_span.arg("nodes", hypergraph.currentNumNodes());
+  const HypernodeID num_pins = hypergraph.currentNumPins();
   HighResClockTimepoint start = std::chrono::high_resolution_clock::now();
   coarsener.coarsen(context.coarsening.contraction_limit);
   HighResClockTimepoint end = std::chrono::high_resolution_clock::now();
+  coarsening_span.arg("coarse_nodes", hypergraph.currentNumNodes());
+  coarsening_span.end();
   Timer::instance().add(context, Timepoint::v_cycle_coarsening,
                         std::chrono::duration<double>(end - start).count());
+  if (TimeBudget::isActive(context)) {
+    context.partition.time_budget->recordCoarsening(
+      std::chrono::duration<double>(end - start).count(), num_pins);
+    context.partition.time_budget->adaptLocalSearch(context);
+  }
 
   if (context.partition.verbose_output && context.type == ContextType::main) {
     io::printHypergraphInfo(hypergraph, "Coarsened Hypergraph");
@@ -58,11 +72,17 @@ static inline bool partitionVCycle(Hypergraph& hypergraph, ICoarsener& coarsener
 
   io::printLocalSearchBanner(context);
 
+  TraceSpan uncoarsening_span(context.partition.trace_recorder, "uncoarsening", "local_search");
   start = std::chrono::high_resolution_clock::now();
   const bool improved_quality = coarsener.uncoarsen(refiner);
   end = std::chrono::high_resolution_clock::now();
+  uncoarsening_span.end();
   Timer::instance().add(context, Timepoint::v_cycle_local_search,
                         std::chrono::duration<double>(end - start).count());
+  if (TimeBudget::isActive(context)) {
+    context.partition.time_budget->recordLocalSearch(
+      std::chrono::duration<double>(end - start).count());
+  }
 
   io::printLocalSearchResults(context, hypergraph);
   return improved_quality;
@@ -70,6 +90,10 @@ static inline bool partitionVCycle(Hypergraph& hypergraph, ICoarsener& coarsener
 
 
 static inline void partition(Hypergraph& hypergraph, const Context& context) {
+  if (context.coarsening.reuse_ratings && context.coarsening.rating_cache == nullptr) {
+    context.coarsening.rating_cache = std::make_shared<RatingCache>();
+  }
+
   std::unique_ptr<ICoarsener> coarsener(
     CoarsenerFactory::getInstance().createObject(
       context.coarsening.algorithm, hypergraph, context,
@@ -89,8 +113,20 @@ static inline void partition(Hypergraph& hypergraph, const Context& context) {
 #endif
 
   for (uint32_t vcycle = 1; vcycle <= context.partition.global_search_iterations; ++vcycle) {
+    if (context.isCancelled()) {
+      break;
+    }
+    if (TimeBudget::isActive(context) && !context.partition.time_budget->allowsVCycle()) {
+      LOG << "Not enough time left for V-cycle" << vcycle << ". Stopping global search.";
+      break;
+    }
+    metrics::reportProgress(hypergraph, context, ProgressPhase::v_cycle);
     context.partition.current_v_cycle = vcycle;
+    TraceSpan span(context.partition.trace_recorder, "v_cycle", "v_cycle");
+    span.arg("v_cycle", vcycle);
     const bool improved_quality = partitionVCycle(hypergraph, *coarsener, *refiner, context);
+    span.arg("improved", improved_quality);
+    span.end();
 
     if (!improved_quality) {
       LOG << "No improvement in V-cycle" << vcycle << ". Stopping global search.";
@@ -23,6 +23,8 @@
 
 #include <algorithm>
 #include <chrono>
+#include <memory>
+#include <string>
 #include <vector>
 
 #include "gtest/gtest_prod.h"
@@ -30,11 +32,16 @@
 #include "kahypar/datastructure/hypergraph.h"
 #include "kahypar/partition/context.h"
 #include "kahypar/partition/context_enum_classes.h"
+#include "kahypar/partition/evolutionary/checkpoint.h"
 #include "kahypar/partition/evolutionary/combine.h"
 #include "kahypar/partition/evolutionary/diversifier.h"
+#include "kahypar/partition/evolutionary/migration.h"
 #include "kahypar/partition/evolutionary/mutate.h"
 #include "kahypar/partition/evolutionary/population.h"
 #include "kahypar/partition/evolutionary/probability_tables.h"
+#include "kahypar/utils/parallel.h"
+#include "kahypar/utils/randomize.h"
+#include "kahypar/utils/trace.h"
 
 
 namespace kahypar {
@@ -45,57 +52,241 @@ class EvoPartitioner {
  public:
   explicit EvoPartitioner(const Context& context) :
     _timelimit(),
+    _start(),
+    _measures_wall_clock_time(false),
+    _time_offset(0.0),
+    _timer_offset(Timer::instance().totalEvolutionaryTime()),
+    _checkpoint_filename(),
+    _last_checkpoint(),
     _population() {
     _timelimit = context.partition.time_limit;
   }
 
   inline void partition(Hypergraph& hg, Context& context) {
     context.partition_evolutionary = true;
+    // Resident edge frequencies refer to the ids of a particular population.
+    context.evolutionary.edge_frequency = nullptr;
+    if (context.coarsening.reuse_ratings) {
+      // shared by all mutations of the population
+      context.coarsening.rating_cache = std::make_shared<RatingCache>();
+    }
 
+    if (context.evolutionary.num_islands > 1 ||
+        !context.evolutionary.migration_directory.empty()) {
+      partitionWithIslands(hg, context);
+      return;
+    }
 
+    _checkpoint_filename = context.evolutionary.checkpoint_filename;
+    resumeFromCheckpoint(hg, context);
     generateInitialPopulation(hg, context);
 
-    while (Timer::instance().evolutionaryResult().total_evolutionary <= _timelimit) {
-      ++context.evolutionary.iteration;
+    while (evolutionaryTime() <= _timelimit && !context.isCancelled()) {
+      performIteration(hg, context);
+      reportProgress(context);
+      writeCheckpoint(hg, context);
+    }
+    MemoryTracker::instance().report(MemoryComponent::population, _population.sizeInBytes());
+    hg.reset();
+    hg.setPartition(_population.individualAt(_population.best()).partition());
+  }
+
+  std::vector<PartitionID> bestPartition() const {
+    return _population.individualAt(_population.best()).partition();
+  }
+
+ private:
+  FRIEND_TEST(TheEvoPartitioner, ProperlyGeneratesTheInitialPopulation);
+  FRIEND_TEST(TheEvoPartitioner, RespectsLimitsOfTheInitialPopulation);
+  FRIEND_TEST(TheEvoPartitioner, IsCorrectlyDecidingTheActions);
+  FRIEND_TEST(TheEvoPartitioner, ExchangesIndividualsBetweenIslands);
+  FRIEND_TEST(TheEvoPartitioner, ExchangesIndividualsBetweenProcessesViaFiles);
+  FRIEND_TEST(TheEvoPartitioner, RunsMultipleIslandsInParallel);
+  FRIEND_TEST(TheEvoPartitioner, ContinuesFromACheckpoint);
+  FRIEND_TEST(TheEvoPartitioner, OnlyMeasuresTheEvolutionaryTimeOfItsOwnRun);
 
+  // Each island evolves its own population on its own copy of the hypergraph in its
+  // own thread. Island 0 uses the input hypergraph. The islands are seeded up front,
+  // such that their evolution does not depend on the scheduling of the threads.
+  // However, the time limit and the arrival of migrants do. If a migration directory
+  // is given, the islands of this process are part of a ring spanning multiple processes
+  // and each process ends with the best individual of its own islands.
+  inline void partitionWithIslands(Hypergraph& hg, Context& context) {
+    ASSERT(hg.currentNumNodes() == hg.initialNumNodes() &&
+           hg.currentNumEdges() == hg.initialNumEdges(),
+           "Island model expects an uncoarsened hypergraph");
+    ASSERT(context.evolutionary.process_id < context.evolutionary.num_processes);
+    const size_t num_islands = context.evolutionary.num_islands;
+    hg.reset();
 
-      if (context.evolutionary.diversify_interval != -1 &&
-          context.evolutionary.iteration % context.evolutionary.diversify_interval == 0) {
-        kahypar::partition::diversify(context);
+    std::vector<std::unique_ptr<Hypergraph> > hypergraphs;
+    std::vector<std::unique_ptr<EvoPartitioner> > islands;
+    std::vector<Context> contexts;
+    std::vector<int> seeds;
+    for (size_t island = 0; island < num_islands; ++island) {
+      hypergraphs.emplace_back(island == 0 ? nullptr : ds::reindex(hg).first.release());
+      islands.emplace_back(new EvoPartitioner(context));
+      contexts.emplace_back(context);
+      Context& island_context = contexts.back();
+      if (context.coarsening.reuse_ratings) {
+        island_context.coarsening.rating_cache = std::make_shared<RatingCache>();
       }
+      island_context.initial_partitioning.race = nullptr;
+      island_context.evolutionary.edge_frequency = nullptr;
+      if (island > 0) {
+        // only one island may write the preprocessing cache
+        island_context.preprocessing.cache_write_filename.clear();
+      }
+      seeds.push_back(Randomize::instance().newRandomSeed());
+    }
+    const int next_seed = Randomize::instance().newRandomSeed();
 
+    std::unique_ptr<Migration> migration = createMigration(context, hg.initialNumNodes());
+    const HighResClockTimepoint start = std::chrono::high_resolution_clock::now();
+    parallel::forEachChunk(num_islands, num_islands,
+                           [&](const size_t island, const size_t, const size_t) {
+        Randomize::instance().setSeed(seeds[island]);
+        Hypergraph& island_hypergraph = island == 0 ? hg : *hypergraphs[island];
+        islands[island]->evolveIsland(island_hypergraph, contexts[island], *migration,
+                                      island, start);
+      });
+    Randomize::instance().setSeed(next_seed);
 
-      EvoDecision decision = decideNextMove(context);
-      DBG << V(decision);
-      switch (decision) {
-        case EvoDecision::mutation:
-          performMutation(hg, context);
-          DBG << _population;
-          break;
-        case EvoDecision::combine:
-          performCombine(hg, context);
-          DBG << _population;
-          break;
-        default:
-          LOG << "Error in evo_partitioner.h: Non-covered case in decision making";
-          std::exit(EXIT_FAILURE);
+    size_t best_island = 0;
+    context.evolutionary.iteration = 0;
+    for (size_t island = 0; island < num_islands; ++island) {
+      context.evolutionary.iteration += contexts[island].evolutionary.iteration;
+      if (islands[island]->_population.bestFitness() <
+          islands[best_island]->_population.bestFitness()) {
+        best_island = island;
       }
+      DBG << V(island) << V(contexts[island].evolutionary.iteration)
+          << V(islands[island]->_population.bestFitness());
     }
+    context.evolutionary.population_size = contexts[best_island].evolutionary.population_size;
+    context.evolutionary.edge_frequency_amount =
+      contexts[best_island].evolutionary.edge_frequency_amount;
+    _population = std::move(islands[best_island]->_population);
+
     hg.reset();
     hg.setPartition(_population.individualAt(_population.best()).partition());
   }
 
-  const std::vector<PartitionID> & bestPartition() const {
-    return _population.individualAt(_population.best()).partition();
+  inline void evolveIsland(Hypergraph& hg, Context& context, Migration& migration,
+                           const size_t island, const HighResClockTimepoint& start) {
+    _start = start;
+    _measures_wall_clock_time = true;
+    if (!context.evolutionary.checkpoint_filename.empty()) {
+      _checkpoint_filename = context.evolutionary.checkpoint_filename + "." +
+                             std::to_string(context.evolutionary.process_id *
+                                            context.evolutionary.num_islands + island);
+    }
+    resumeFromCheckpoint(hg, context);
+    generateInitialPopulation(hg, context);
+
+    while (evolutionaryTime() <= _timelimit && !context.isCancelled()) {
+      performIteration(hg, context);
+      reportProgress(context);
+      if (context.evolutionary.iteration % context.evolutionary.migration_interval == 0) {
+        migrate(hg, context, migration, island);
+      }
+      writeCheckpoint(hg, context);
+    }
+    MemoryTracker::instance().report(MemoryComponent::population, _population.sizeInBytes());
+  }
+
+  inline void resumeFromCheckpoint(const Hypergraph& hg, Context& context) {
+    _last_checkpoint = std::chrono::high_resolution_clock::now();
+    if (!context.evolutionary.resume || _checkpoint_filename.empty()) {
+      return;
+    }
+    if (EvoCheckpoint::read(_checkpoint_filename, hg, context, _population, _time_offset)) {
+      if (!context.partition.quiet_mode) {
+        LOG << "Resuming from checkpoint" << _checkpoint_filename << "after"
+            << _time_offset << "s with" << _population.size() << "individuals";
+      }
+    } else if (!context.partition.quiet_mode) {
+      LOG << "No valid checkpoint" << _checkpoint_filename << "- starting from scratch";
+    }
+  }
+
+  inline void writeCheckpoint(const Hypergraph& hg, const Context& context) {
+    const HighResClockTimepoint now = std::chrono::high_resolution_clock::now();
+    if (_checkpoint_filename.empty() ||
+        std::chrono::duration<double>(now - _last_checkpoint).count() <
+        context.evolutionary.checkpoint_interval) {
+      return;
+    }
+    EvoCheckpoint::write(_checkpoint_filename, hg, context, _population, evolutionaryTime());
+    _last_checkpoint = now;
+  }
+
+  inline void migrate(Hypergraph& hg, const Context& context, Migration& migration,
+                      const size_t island) {
+    const size_t num_migrants = std::min(context.evolutionary.num_migrants, _population.size());
+    for (const Individual& individual : _population.listOfBest(num_migrants)) {
+      migration.send(island, individual.partition());
+    }
+    for (const std::vector<PartitionID>& partition : migration.receive(island)) {
+      hg.setPartition(partition);
+      const size_t position = _population.insert(Individual(hg, context), context);
+      DBG << "Island" << island << "received migrant" << V(position);
+    }
+  }
+
+  // All islands add their timings to the same timer. Therefore, islands
+  // measure the elapsed wall-clock time instead. The time offset is the
+  // evolutionary time that elapsed before the run was resumed. The timer offset
+  // excludes the time of previous runs in the same thread.
+  inline double evolutionaryTime() const {
+    if (_measures_wall_clock_time) {
+      return _time_offset +
+             std::chrono::duration<double>(std::chrono::high_resolution_clock::now() -
+                                           _start).count();
+    }
+    return _time_offset + Timer::instance().totalEvolutionaryTime() - _timer_offset;
+  }
+
+  // Individuals do not store their imbalance.
+  inline void reportProgress(const Context& context) const {
+    if (context.partition.control != nullptr && context.type == ContextType::main) {
+      context.partition.control->report(ProgressPhase::evolutionary,
+                                        _population.bestFitness(), -1.0);
+    }
+  }
+
+  inline void performIteration(Hypergraph& hg, Context& context) {
+    ++context.evolutionary.iteration;
+    TraceSpan span(context.partition.trace_recorder, "evo_generation", "evolutionary");
+    span.arg("iteration", context.evolutionary.iteration);
+
+    if (context.evolutionary.diversify_interval != -1 &&
+        context.evolutionary.iteration % context.evolutionary.diversify_interval == 0) {
+      kahypar::partition::diversify(context);
+    }
+
+    EvoDecision decision = decideNextMove(context);
+    DBG << V(decision);
+    span.arg("decision", decision);
+    switch (decision) {
+      case EvoDecision::mutation:
+        performMutation(hg, context);
+        DBG << _population;
+        break;
+      case EvoDecision::combine:
+        performCombine(hg, context);
+        DBG << _population;
+        break;
+      default:
+        LOG << "Error in evo_partitioner.h: Non-covered case in decision making";
+        std::exit(EXIT_FAILURE);
+    }
   }
 
- private:
-  FRIEND_TEST(TheEvoPartitioner, ProperlyGeneratesTheInitialPopulation);
-  FRIEND_TEST(TheEvoPartitioner, RespectsLimitsOfTheInitialPopulation);
-  FRIEND_TEST(TheEvoPartitioner, IsCorrectlyDecidingTheActions);
   inline void generateInitialPopulation(Hypergraph& hg, Context& context) {
     // INITIAL POPULATION
-    if (context.evolutionary.dynamic_population_size) {
+    // A resumed population already has its final size.
+    if (context.evolutionary.dynamic_population_size && _population.size() == 0) {
       HighResClockTimepoint start = std::chrono::high_resolution_clock::now();
       _population.generateIndividual(hg, context);
       HighResClockTimepoint end = std::chrono::high_resolution_clock::now();
@@ -106,7 +297,7 @@ class EvoPartitioner {
       io::serializer::serializeEvolutionary(context, hg);
       int dynamic_population_size = std::round(context.evolutionary.dynamic_population_amount_of_time
                                                * context.partition.time_limit
-                                               / Timer::instance().evolutionaryResult().total_evolutionary);
+                                               / evolutionaryTime());
       int minimal_size = std::max(dynamic_population_size, 3);
 
       context.evolutionary.population_size = std::min(minimal_size, 50);
@@ -117,8 +308,11 @@ class EvoPartitioner {
     DBG << "EDGE-FREQUENCY-AMOUNT";
     DBG << context.evolutionary.edge_frequency_amount;
     while (_population.size() < context.evolutionary.population_size &&
-           Timer::instance().evolutionaryResult().total_evolutionary <= _timelimit) {
+           evolutionaryTime() <= _timelimit &&
+           (_population.size() == 0 || !context.isCancelled())) {
       ++context.evolutionary.iteration;
+      TraceSpan span(context.partition.trace_recorder, "evo_initial_individual", "evolutionary");
+      span.arg("iteration", context.evolutionary.iteration);
       HighResClockTimepoint start = std::chrono::high_resolution_clock::now();
       _population.generateIndividual(hg, context);
       HighResClockTimepoint end = std::chrono::high_resolution_clock::now();
@@ -127,6 +321,8 @@ class EvoPartitioner {
       io::serializer::serializeEvolutionary(context, hg);
       verbose(context, 0);
       DBG << _population;
+      reportProgress(context);
+      writeCheckpoint(hg, context);
     }
   }
 
@@ -225,6 +421,12 @@ class EvoPartitioner {
 
 
   int _timelimit;
+  HighResClockTimepoint _start;
+  bool _measures_wall_clock_time;
+  double _time_offset;
+  const double _timer_offset;
+  std::string _checkpoint_filename;
+  HighResClockTimepoint _last_checkpoint;
   Population _population;
 };
 }  // namespace kahypar
@@ -0,0 +1,197 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2019 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "kahypar/definitions.h"
+#include "kahypar/partition/context.h"
+#include "kahypar/partition/evolutionary/individual.h"
+#include "kahypar/partition/evolutionary/population.h"
+#include "kahypar/utils/randomize.h"
+
+namespace kahypar {
+/*!
+ * Binary checkpoint of an evolutionary run, i.e. the population (bit-packed), the
+ * evolutionary state of the context, the coarsening parameters changed by
+ * diversification, the elapsed evolutionary time and the state of the random
+ * number generator of the calling thread.
+ *
+ * Checkpoints are written to a temporary file that is renamed afterwards, such that
+ * a run that is killed while writing leaves the last complete checkpoint intact.
+ * A checkpoint can only be read for a hypergraph with the same number of hypernodes
+ * and hyperedges and for the same k and objective.
+ */
+class EvoCheckpoint {
+  static constexpr uint64_t kMagic = 0x4b61487950617245;  // "KaHyParE"
+
+ public:
+  static bool write(const std::string& filename, const Hypergraph& hypergraph,
+                    const Context& context, const Population& population,
+                    const double elapsed_time) {
+    const std::string tmp_filename = filename + ".tmp";
+    bool written = false;
+    {
+      std::ofstream file(tmp_filename, std::ios::binary | std::ios::trunc);
+      const uint64_t magic = kMagic;
+      writeValue(file, magic);
+      writeHeader(file, hypergraph, context);
+      writeValue(file, static_cast<int32_t>(context.evolutionary.iteration));
+      writeValue(file, static_cast<uint64_t>(context.evolutionary.population_size));
+      writeValue(file, static_cast<uint64_t>(context.evolutionary.edge_frequency_amount));
+      writeValue(file, context.coarsening.max_allowed_weight_multiplier);
+      writeValue(file, context.coarsening.contraction_limit_multiplier);
+      writeValue(file, static_cast<uint8_t>(context.coarsening.algorithm));
+      writeValue(file, elapsed_time);
+      const std::string random_state = Randomize::instance().state();
+      writeValue(file, static_cast<uint64_t>(random_state.size()));
+      file.write(random_state.data(), random_state.size());
+      writeValue(file, static_cast<uint64_t>(population.size()));
+      for (size_t i = 0; i < population.size(); ++i) {
+        population.individualAt(i).write(file);
+      }
+      file.close();
+      written = static_cast<bool>(file);
+    }
+    if (!written || std::rename(tmp_filename.c_str(), filename.c_str()) != 0) {
+      LOG << "Error: Could not write evolutionary checkpoint" << filename;
+      std::remove(tmp_filename.c_str());
+      return false;
+    }
+    return true;
+  }
+
+  // If the checkpoint is valid, the population, context and random number
+  // generator are restored. Otherwise, nothing is changed.
+  static bool read(const std::string& filename, const Hypergraph& hypergraph,
+                   Context& context, Population& population, double& elapsed_time) {
+    std::ifstream file(filename, std::ios::binary);
+    uint64_t magic = 0;
+    readValue(file, magic);
+    if (!file || magic != kMagic || !readAndCheckHeader(file, hypergraph, context)) {
+      return false;
+    }
+    int32_t iteration = 0;
+    uint64_t population_size = 0;
+    uint64_t edge_frequency_amount = 0;
+    double max_allowed_weight_multiplier = 0.0;
+    HypernodeID contraction_limit_multiplier = 0;
+    uint8_t coarsening_algorithm = 0;
+    double time = 0.0;
+    uint64_t random_state_size = 0;
+    readValue(file, iteration);
+    readValue(file, population_size);
+    readValue(file, edge_frequency_amount);
+    readValue(file, max_allowed_weight_multiplier);
+    readValue(file, contraction_limit_multiplier);
+    readValue(file, coarsening_algorithm);
+    readValue(file, time);
+    readValue(file, random_state_size);
+    if (!file || random_state_size > (1 << 20) ||
+        coarsening_algorithm > static_cast<uint8_t>(CoarseningAlgorithm::UNDEFINED)) {
+      return false;
+    }
+    std::string random_state(random_state_size, ' ');
+    file.read(&random_state[0], random_state_size);
+
+    uint64_t num_individuals = 0;
+    readValue(file, num_individuals);
+    if (!file || num_individuals > population_size) {
+      return false;
+    }
+    std::vector<Individual> individuals;
+    for (uint64_t i = 0; i < num_individuals; ++i) {
+      Individual individual;
+      if (!individual.read(file, hypergraph.initialNumNodes(), hypergraph.initialNumEdges(),
+                           hypergraph.k()) ||
+          !isValid(individual, hypergraph)) {
+        return false;
+      }
+      individuals.push_back(std::move(individual));
+    }
+    if (!Randomize::instance().setState(random_state)) {
+      return false;
+    }
+
+    context.evolutionary.iteration = iteration;
+    context.evolutionary.population_size = population_size;
+    context.evolutionary.edge_frequency_amount = edge_frequency_amount;
+    context.coarsening.max_allowed_weight_multiplier = max_allowed_weight_multiplier;
+    context.coarsening.contraction_limit_multiplier = contraction_limit_multiplier;
+    context.coarsening.algorithm = static_cast<CoarseningAlgorithm>(coarsening_algorithm);
+    elapsed_time = time;
+    for (Individual& individual : individuals) {
+      population.add(std::move(individual));
+    }
+    return true;
+  }
+
+ private:
+  static void writeHeader(std::ofstream& file, const Hypergraph& hypergraph,
+                          const Context& context) {
+    writeValue(file, hypergraph.initialNumNodes());
+    writeValue(file, hypergraph.initialNumEdges());
+    writeValue(file, context.partition.k);
+    writeValue(file, static_cast<uint8_t>(context.partition.objective));
+  }
+
+  static bool readAndCheckHeader(std::ifstream& file, const Hypergraph& hypergraph,
+                                 const Context& context) {
+    HypernodeID num_nodes = 0;
+    HyperedgeID num_edges = 0;
+    PartitionID k = 0;
+    uint8_t objective = 0;
+    readValue(file, num_nodes);
+    readValue(file, num_edges);
+    readValue(file, k);
+    readValue(file, objective);
+    return file && num_nodes == hypergraph.initialNumNodes() &&
+           num_edges == hypergraph.initialNumEdges() && k == context.partition.k &&
+           objective == static_cast<uint8_t>(context.partition.objective);
+  }
+
+  // The sizes and bit widths of the partition and connectivity arrays are already
+  // checked while reading.
+  static bool isValid(const Individual& individual, const Hypergraph& hypergraph) {
+    for (const HypernodeID& hn : hypergraph.nodes()) {
+      if (individual.partID(hn) >= hypergraph.k()) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  template <typename T>
+  static void readValue(std::ifstream& file, T& value) {
+    file.read(reinterpret_cast<char*>(&value), sizeof(T));
+  }
+
+  template <typename T>
+  static void writeValue(std::ofstream& file, const T& value) {
+    file.write(reinterpret_cast<const char*>(&value), sizeof(T));
+  }
+};
+}  // namespace kahypar
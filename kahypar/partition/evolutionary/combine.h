@@ -22,6 +22,7 @@
 
 #include <algorithm>
 #include <limits>
+#include <memory>
 #include <utility>
 #include <vector>
 
@@ -41,8 +42,11 @@ Individual partitions(Hypergraph& hg,
   DBG << V(context.evolutionary.action.decision());
   DBG << "Parent 1: initial" << V(parents.first.fitness());
   DBG << "Parent 2: initial" << V(parents.second.fitness());
-  context.evolutionary.parent1 = &parents.first.partition();
-  context.evolutionary.parent2 = &parents.second.partition();
+  // The parents are unpacked once, since they are accessed for each contraction.
+  const std::vector<PartitionID> parent1 = parents.first.partition();
+  const std::vector<PartitionID> parent2 = parents.second.partition();
+  context.evolutionary.parent1 = &parent1;
+  context.evolutionary.parent2 = &parent2;
 #ifndef NDEBUG
   ASSERT(parents.first.fitness() == ([](Hypergraph& hg, const Parents& parents) -> int {
         hg.setPartition(parents.first.partition());
@@ -111,9 +115,15 @@ Individual edgeFrequency(Hypergraph& hg, const Context& context, const Populatio
   temporary_context.coarsening.rating.heavy_node_penalty_policy =
     HeavyNodePenaltyPolicy::edge_frequency_penalty;
 
-  temporary_context.evolutionary.edge_frequency =
-    computeEdgeFrequency(population.listOfBest(context.evolutionary.edge_frequency_amount),
-                         hg.initialNumEdges());
+  if (!context.evolutionary.edge_frequency) {
+    context.evolutionary.edge_frequency = std::make_shared<EdgeFrequency>();
+  }
+  const size_t amount = context.evolutionary.edge_frequency_amount;
+  context.evolutionary.edge_frequency->update(population.idsOfBest(amount),
+                                              population.listOfBest(amount),
+                                              hg.initialNumEdges(),
+                                              context.evolutionary.edge_frequency_num_threads);
+  temporary_context.evolutionary.edge_frequency = context.evolutionary.edge_frequency;
 
   DBG << V(temporary_context.evolutionary.action.decision());
 
@@ -20,19 +20,142 @@
 ******************************************************************************/
 #pragma once
 
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <utility>
 #include <vector>
 
+#include "kahypar/datastructure/packed_integer_array.h"
 #include "kahypar/partition/evolutionary/individual.h"
+#include "kahypar/utils/parallel.h"
 
 namespace kahypar {
-std::vector<size_t> computeEdgeFrequency(const Individuals& edge_frequency_targets,
-                                         const HyperedgeID num_hyperedges) {
+inline std::vector<size_t> computeEdgeFrequency(const Individuals& edge_frequency_targets,
+                                                const HyperedgeID num_hyperedges) {
   std::vector<size_t> result(num_hyperedges, 0);
   for (const auto& individual : edge_frequency_targets) {
-    for (const HyperedgeID cut_he : individual.get().cutEdges()) {
-      result[cut_he] += 1;
-    }
+    individual.get().forEachCutEdge([&](const HyperedgeID cut_he) {
+        result[cut_he] += 1;
+      });
   }
   return result;
 }
+
+/*!
+ * Edge frequencies of the best individuals of a population that are kept
+ * resident across combine operations.
+ *
+ * Instead of recounting all cut edges of all best individuals for each combine,
+ * update() only subtracts the cut edges of the individuals that are no longer among
+ * the best and adds those of the new ones. Each contributing individual is
+ * identified by its population id and remembered with its cut edges, which are
+ * stored as a bit-packed array with one bit per hyperedge. Counting is parallelized
+ * over disjoint ranges of hyperedges, so that each thread only writes to its own
+ * part of the frequency array and no reduction is necessary. The threads are kept
+ * alive across updates. Copies of a context share the same resident frequencies.
+ */
+class EdgeFrequency {
+ private:
+  struct Contributor {
+    Contributor() :
+      id(0),
+      cut_edges() { }
+
+    size_t id;
+    ds::PackedIntegerArray cut_edges;
+  };
+
+ public:
+  EdgeFrequency() :
+    _frequency(),
+    _contributors(),
+    _thread_pool() { }
+
+  EdgeFrequency(const EdgeFrequency&) = delete;
+  EdgeFrequency& operator= (const EdgeFrequency&) = delete;
+
+  EdgeFrequency(EdgeFrequency&&) = default;
+  EdgeFrequency& operator= (EdgeFrequency&&) = default;
+
+  ~EdgeFrequency() = default;
+
+  size_t operator[] (const HyperedgeID he) const {
+    return _frequency[he];
+  }
+
+  const std::vector<size_t> & frequencies() const {
+    return _frequency;
+  }
+
+  size_t numContributors() const {
+    return _contributors.size();
+  }
+
+  // Makes the frequencies reflect the cut edges of the given individuals, which are
+  // identified by their population ids (see Population::idsOfBest).
+  void update(const std::vector<size_t>& ids, const Individuals& individuals,
+              const HyperedgeID num_hyperedges, const size_t num_threads) {
+    ASSERT(ids.size() == individuals.size());
+    if (_frequency.size() != num_hyperedges) {
+      _frequency.assign(num_hyperedges, 0);
+      _contributors.clear();
+    }
+    const size_t pool_size = std::max(num_threads, static_cast<size_t>(1));
+    if (_thread_pool == nullptr || _thread_pool->numThreads() != pool_size) {
+      _thread_pool.reset(new parallel::ThreadPool(pool_size));
+    }
+
+    std::vector<Contributor> kept;
+    std::vector<Contributor> removed;
+    for (Contributor& contributor : _contributors) {
+      const bool is_contained = std::find(ids.begin(), ids.end(), contributor.id) != ids.end();
+      (is_contained ? kept : removed).push_back(std::move(contributor));
+    }
+    std::vector<size_t> new_individuals;
+    for (size_t i = 0; i < ids.size(); ++i) {
+      if (std::none_of(kept.begin(), kept.end(), [&](const Contributor& contributor) {
+            return contributor.id == ids[i];
+          })) {
+        new_individuals.push_back(i);
+      }
+    }
+
+    std::vector<Contributor> added(new_individuals.size());
+    _thread_pool->forEachChunk(new_individuals.size(),
+                               [&](const size_t, const size_t begin, const size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+          added[i].id = ids[new_individuals[i]];
+          added[i].cut_edges = ds::PackedIntegerArray(num_hyperedges, 1);
+          individuals[new_individuals[i]].get().forEachCutEdge([&](const HyperedgeID he) {
+              added[i].cut_edges.set(he, 1);
+            });
+        }
+      });
+
+    _thread_pool->forEachChunk(num_hyperedges,
+                               [&](const size_t, const size_t begin, const size_t end) {
+        for (const Contributor& contributor : removed) {
+          contributor.cut_edges.forEachNonzero(begin, end, [&](const size_t he, uint32_t) {
+              ASSERT(_frequency[he] > 0);
+              --_frequency[he];
+            });
+        }
+        for (const Contributor& contributor : added) {
+          contributor.cut_edges.forEachNonzero(begin, end, [&](const size_t he, uint32_t) {
+              ++_frequency[he];
+            });
+        }
+      });
+
+    _contributors = std::move(kept);
+    std::move(added.begin(), added.end(), std::back_inserter(_contributors));
+    ASSERT(_frequency == computeEdgeFrequency(individuals, num_hyperedges));
+  }
+
+ private:
+  std::vector<size_t> _frequency;
+  std::vector<Contributor> _contributors;
+  std::unique_ptr<parallel::ThreadPool> _thread_pool;
+};
 }  // namespace kahypar
@@ -20,14 +20,27 @@
 ******************************************************************************/
 #pragma once
 
+#include <algorithm>
+#include <istream>
 #include <limits>
+#include <ostream>
 #include <utility>
 #include <vector>
 
+#include "kahypar/datastructure/packed_integer_array.h"
 #include "kahypar/definitions.h"
 #include "kahypar/partition/metrics.h"
 
 namespace kahypar {
+/*!
+ * An individual of the evolutionary algorithm, i.e. a partition and its fitness.
+ *
+ * To keep large populations in memory, the partition is bit-packed to
+ * ceil(log2(k)) bits per hypernode. Instead of the cut edges and the strong cut
+ * edges (i.e. each cut edge repeated connectivity - 1 times), the individual stores
+ * connectivity - 1 for each hyperedge with the same number of bits. Both sets
+ * are derived from it on demand.
+ */
 class Individual {
  private:
   static constexpr bool debug = false;
@@ -35,44 +48,52 @@ class Individual {
  public:
   Individual() :
     _partition(),
-    _cut_edges(),
-    _strong_cut_edges(),
+    _connectivity(),
     _fitness() { }
 
   explicit Individual(const HyperedgeWeight fitness) :
     _partition(),
-    _cut_edges(),
-    _strong_cut_edges(),
+    _connectivity(),
     _fitness(fitness) { }
 
   explicit Individual(const std::vector<PartitionID>& partition) :
-    _partition(std::move(partition)),
-    _cut_edges(),
-    _strong_cut_edges(),
-    _fitness(std::numeric_limits<HyperedgeWeight>::max()) { }
+    _partition(partition.size(), maxPartID(partition)),
+    _connectivity(),
+    _fitness(std::numeric_limits<HyperedgeWeight>::max()) {
+    for (size_t hn = 0; hn < partition.size(); ++hn) {
+      _partition.set(hn, partition[hn]);
+    }
+  }
 
   explicit Individual(const Hypergraph& hypergraph, const Context& context) :
-    _partition(),
-    _cut_edges(),
-    _strong_cut_edges(),
+    _partition(hypergraph.initialNumNodes(), hypergraph.k() - 1),
+    _connectivity(hypergraph.initialNumEdges(), hypergraph.k() - 1),
     _fitness() {
+    ASSERT(hypergraph.currentNumNodes() == hypergraph.initialNumNodes());
     for (const HypernodeID& hn : hypergraph.nodes()) {
-      _partition.push_back(hypergraph.partID(hn));
+      ASSERT(hypergraph.partID(hn) != Hypergraph::kInvalidPartition, V(hn));
+      _partition.set(hn, hypergraph.partID(hn));
     }
 
-    _fitness = metrics::correctMetric(hypergraph, context);
-
+    // The cut edges are extracted in a single pass over the connectivities maintained
+    // by the hypergraph, i.e., building an individual still takes O(m) time. The
+    // fitness is summed up in the same pass. The refiners do not maintain a set of cut
+    // hyperedges (their Metrics only track the objective value), so this pass is
+    // needed anyway and taking the objective from the refiners would not save time.
+    const bool is_km1 = context.partition.objective == Objective::km1;
+    _fitness = 0;
     for (const HyperedgeID& he : hypergraph.edges()) {
-      if (hypergraph.connectivity(he) > 1) {
-        _cut_edges.push_back(he);
-        // The general idea is to add the connectivity (#blocks - 1)
-        // instead of the # of blocks (However there should not be that much of a difference)
-        // Edit: For Test Purposes this loop starts with 1.
-        for (PartitionID i = 1; i < hypergraph.connectivity(he); ++i) {
-          _strong_cut_edges.push_back(he);
-        }
+      // The general idea is to add the connectivity (#blocks - 1)
+      // instead of the # of blocks (However there should not be that much of a difference)
+      const PartitionID connectivity = hypergraph.connectivity(he);
+      if (connectivity > 1) {
+        _connectivity.set(he, connectivity - 1);
+        _fitness += is_km1 ? (connectivity - 1) * hypergraph.edgeWeight(he) :
+                    hypergraph.edgeWeight(he);
       }
     }
+    ASSERT(_fitness == metrics::correctMetric(hypergraph, context),
+           V(_fitness) << V(metrics::correctMetric(hypergraph, context)));
     DBG << "New individual" << V(_fitness);
   }
 
@@ -87,53 +108,122 @@ class Individual {
     return _fitness;
   }
 
+  inline size_t numNodes() const {
+    return _partition.size();
+  }
+
+  inline PartitionID partID(const HypernodeID hn) const {
+    return _partition.get(hn);
+  }
+
+  inline std::vector<PartitionID> partition() const {
+    ASSERT(_partition.size() > 0);
+    std::vector<PartitionID> partition(_partition.size());
+    for (size_t hn = 0; hn < partition.size(); ++hn) {
+      partition[hn] = _partition.get(hn);
+    }
+    return partition;
+  }
+
+  // Calls f(he) for each cut hyperedge in increasing order.
+  template <typename F>
+  inline void forEachCutEdge(const F& f) const {
+    _connectivity.forEachNonzero([&](const size_t he, const uint32_t) {
+        f(static_cast<HyperedgeID>(he));
+      });
+  }
+
+  inline std::vector<HyperedgeID> cutEdges() const {
+    std::vector<HyperedgeID> cut_edges;
+    forEachCutEdge([&](const HyperedgeID he) {
+        cut_edges.push_back(he);
+      });
+    return cut_edges;
+  }
 
-  inline const std::vector<PartitionID> & partition() const {
-    ASSERT(!_partition.empty());
-    return _partition;
+  inline std::vector<HyperedgeID> strongCutEdges() const {
+    std::vector<HyperedgeID> strong_cut_edges;
+    _connectivity.forEachNonzero([&](const size_t he, const uint32_t connectivity_minus_one) {
+        strong_cut_edges.insert(strong_cut_edges.end(), connectivity_minus_one, he);
+      });
+    return strong_cut_edges;
   }
-  inline const std::vector<HyperedgeID> & cutEdges() const {
-    ASSERT(!_cut_edges.empty());
-    return _cut_edges;
+
+  // Size of the symmetric difference of the (strong) cut edges of both individuals.
+  inline size_t difference(const Individual& other, const bool strong_set) const {
+    size_t difference = 0;
+    _connectivity.forEachDifference(other._connectivity,
+                                    [&](const size_t, const uint32_t lhs, const uint32_t rhs) {
+        if (strong_set) {
+          difference += lhs > rhs ? lhs - rhs : rhs - lhs;
+        } else {
+          difference += (lhs > 0) != (rhs > 0);
+        }
+      });
+    return difference;
+  }
+
+  inline void write(std::ostream& out) const {
+    out.write(reinterpret_cast<const char*>(&_fitness), sizeof(_fitness));
+    _partition.write(out);
+    _connectivity.write(out);
   }
 
-  inline const std::vector<HyperedgeID> & strongCutEdges() const {
-    ASSERT(!_strong_cut_edges.empty());
-    return _strong_cut_edges;
+  // Returns false, if the stream does not contain a valid individual of a hypergraph
+  // with the given number of hypernodes and hyperedges and the given k.
+  inline bool read(std::istream& in, const HypernodeID num_nodes,
+                   const HyperedgeID num_edges, const PartitionID k) {
+    in.read(reinterpret_cast<char*>(&_fitness), sizeof(_fitness));
+    return in && _partition.read(in, num_nodes, k - 1) &&
+           _connectivity.read(in, num_edges, k - 1);
   }
+
+  inline size_t sizeInBytes() const {
+    return _partition.sizeInBytes() + _connectivity.sizeInBytes();
+  }
+
   inline void print() const {
     LOG << "Fitness:" << _fitness;
   }
   inline void printDebug() const {
     LOG << "Fitness:" << _fitness;
     LOG << "Partition :---------------------------------------";
-    for (const PartitionID part : _partition) {
+    for (const PartitionID part : partition()) {
       LLOG << part;
     }
     LOG << "\n--------------------------------------------------";
     LOG << "Cut Edges :---------------------------------------";
-    for (const HyperedgeID cut_edge : _cut_edges) {
+    for (const HyperedgeID cut_edge : cutEdges()) {
       LLOG << cut_edge;
     }
     LOG << "\n--------------------------------------------------";
     LOG << "Strong Cut Edges :--------------------------------";
-    for (const HyperedgeID strong_cut_edge :  _strong_cut_edges) {
+    for (const HyperedgeID strong_cut_edge : strongCutEdges()) {
       LLOG << strong_cut_edge;
     }
     LOG << "\n--------------------------------------------------";
   }
 
  private:
-  std::vector<PartitionID> _partition;
-  std::vector<HyperedgeID> _cut_edges;
-  std::vector<HyperedgeID> _strong_cut_edges;
+  static uint32_t maxPartID(const std::vector<PartitionID>& partition) {
+    PartitionID max_part = 0;
+    for (const PartitionID part : partition) {
+      ASSERT(part >= 0, V(part));
+      max_part = std::max(max_part, part);
+    }
+    return max_part;
+  }
+
+  ds::PackedIntegerArray _partition;
+  // connectivity - 1 of each hyperedge
+  ds::PackedIntegerArray _connectivity;
   HyperedgeWeight _fitness;
 };
 std::ostream& operator<< (std::ostream& os, const Individual& individual) {
   os << "Fitness: " << individual.fitness() << std::endl;
   os << "Partition:------------------------------------" << std::endl;
-  for (size_t i = 0; i < individual.partition().size(); ++i) {
-    os << individual.partition()[i] << " ";
+  for (const PartitionID part : individual.partition()) {
+    os << part << " ";
   }
   return os;
 }
@@ -0,0 +1,284 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2019 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <dirent.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "kahypar/datastructure/packed_integer_array.h"
+#include "kahypar/definitions.h"
+#include "kahypar/partition/context.h"
+
+namespace kahypar {
+/*!
+ * Exchange of individuals between the islands of the evolutionary algorithm.
+ *
+ * The islands are connected in a directed ring: Island i sends its migrants to
+ * island (i + 1) mod #islands. Each island has an inbox that holds at most
+ * capacity partitions. If an island does not collect its migrants in time,
+ * the oldest ones are dropped. Islands are numbered locally within each process.
+ */
+class Migration {
+ public:
+  Migration(const Migration&) = delete;
+  Migration& operator= (const Migration&) = delete;
+
+  Migration(Migration&&) = delete;
+  Migration& operator= (Migration&&) = delete;
+
+  virtual ~Migration() = default;
+
+  virtual void send(const size_t island, std::vector<PartitionID>&& partition) = 0;
+  virtual std::vector<std::vector<PartitionID> > receive(const size_t island) = 0;
+
+ protected:
+  Migration() = default;
+};
+
+// Islands that run as threads of the same process.
+class LocalMigration final : public Migration {
+ public:
+  LocalMigration(const size_t num_islands, const size_t capacity) :
+    _capacity(capacity),
+    _mutex(),
+    _inboxes(num_islands) { }
+
+  void send(const size_t island, std::vector<PartitionID>&& partition) override {
+    std::lock_guard<std::mutex> lock(_mutex);
+    std::vector<std::vector<PartitionID> >& inbox = _inboxes[(island + 1) % _inboxes.size()];
+    inbox.push_back(std::move(partition));
+    if (inbox.size() > _capacity) {
+      inbox.erase(inbox.begin());
+    }
+  }
+
+  std::vector<std::vector<PartitionID> > receive(const size_t island) override {
+    std::lock_guard<std::mutex> lock(_mutex);
+    std::vector<std::vector<PartitionID> > migrants;
+    migrants.swap(_inboxes[island]);
+    return migrants;
+  }
+
+ private:
+  const size_t _capacity;
+  std::mutex _mutex;
+  std::vector<std::vector<std::vector<PartitionID> > > _inboxes;
+};
+
+/*!
+ * Islands that run in different processes, possibly on different hosts, and
+ * coordinate via a directory that all of them can access (e.g. a local directory
+ * or a shared file system).
+ *
+ * Process p with l islands owns the global islands p * l, ..., p * l + l - 1 of a
+ * ring of #processes * l islands. A migrant is written as a bit-packed partition
+ * vector to a temporary file that is renamed to
+ * island<target>.<sender>.<sequence number>.part afterwards, such that receivers
+ * never see incomplete files. Receiving reads and deletes all files addressed to
+ * an island. Migrants for a hypergraph of a different size or k are dropped.
+ * All processes have to partition the same hypergraph with the same k, and the
+ * directory should not contain migrants of previous runs.
+ *
+ * When a process finishes, it creates the marker file finished.<process id> and
+ * deletes all migrants addressed to its islands. Other processes stop sending
+ * migrants to it and delete migrants that they renamed after the marker appeared.
+ * The marker is removed when a process with the same id starts again.
+ */
+class FileMigration final : public Migration {
+  static constexpr uint64_t kMagic = 0x4b61487950617249;  // "KaHyParI"
+
+ public:
+  FileMigration(const std::string& directory, const size_t process_id,
+                const size_t num_processes, const size_t num_islands, const size_t capacity,
+                const HypernodeID num_nodes, const PartitionID k) :
+    _directory(directory),
+    _first_island(process_id * num_islands),
+    _num_islands(num_islands),
+    _num_global_islands(num_processes * num_islands),
+    _capacity(capacity),
+    _num_nodes(num_nodes),
+    _k(k),
+    _mutex(),
+    _sequence_number(0) {
+    std::remove(finishedMarker(process_id).c_str());
+  }
+
+  ~FileMigration() override {
+    std::ofstream(finishedMarker(_first_island / _num_islands));
+    for (size_t island = 0; island < _num_islands; ++island) {
+      for (const std::string& name : inbox(_first_island + island)) {
+        std::remove((_directory + "/" + name).c_str());
+      }
+    }
+  }
+
+  FileMigration(const FileMigration&) = delete;
+  FileMigration& operator= (const FileMigration&) = delete;
+
+  FileMigration(FileMigration&&) = delete;
+  FileMigration& operator= (FileMigration&&) = delete;
+
+  void send(const size_t island, std::vector<PartitionID>&& partition) override {
+    const size_t sender = _first_island + island;
+    const size_t target = (sender + 1) % _num_global_islands;
+    const std::string target_marker = finishedMarker(target / _num_islands);
+    if (exists(target_marker)) {
+      return;
+    }
+    uint64_t sequence_number = 0;
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      sequence_number = _sequence_number++;
+    }
+    std::ostringstream name;
+    name << inboxPrefix(target) << sender << "." << std::setw(12) << std::setfill('0')
+         << sequence_number << ".part";
+    const std::string filename = _directory + "/" + name.str();
+    const std::string tmp_filename = filename + ".tmp";
+    bool written = false;
+    {
+      std::ofstream file(tmp_filename, std::ios::binary | std::ios::trunc);
+      const uint64_t magic = kMagic;
+      const int32_t k = _k;
+      file.write(reinterpret_cast<const char*>(&magic), sizeof(magic));
+      file.write(reinterpret_cast<const char*>(&k), sizeof(k));
+      ds::PackedIntegerArray packed(partition.size(), static_cast<uint32_t>(_k - 1));
+      for (size_t i = 0; i < partition.size(); ++i) {
+        packed.set(i, partition[i]);
+      }
+      packed.write(file);
+      file.close();
+      written = static_cast<bool>(file);
+    }
+    if (!written || std::rename(tmp_filename.c_str(), filename.c_str()) != 0) {
+      LOG << "Error: Could not write migrant" << filename;
+      std::remove(tmp_filename.c_str());
+      return;
+    }
+    if (exists(target_marker)) {
+      // the target finished while the migrant was written
+      std::remove(filename.c_str());
+    }
+  }
+
+  std::vector<std::vector<PartitionID> > receive(const size_t island) override {
+    const std::vector<std::string> names = inbox(_first_island + island);
+    std::vector<std::vector<PartitionID> > migrants;
+    for (size_t i = 0; i < names.size(); ++i) {
+      const std::string filename = _directory + "/" + names[i];
+      std::vector<PartitionID> partition;
+      if (i + _capacity >= names.size() && read(filename, partition)) {
+        migrants.push_back(std::move(partition));
+      }
+      std::remove(filename.c_str());
+    }
+    return migrants;
+  }
+
+ private:
+  static std::string inboxPrefix(const size_t island) {
+    return "island" + std::to_string(island) + ".";
+  }
+
+  static bool exists(const std::string& filename) {
+    return static_cast<bool>(std::ifstream(filename));
+  }
+
+  std::string finishedMarker(const size_t process_id) const {
+    return _directory + "/finished." + std::to_string(process_id);
+  }
+
+  // Names of all complete migrants addressed to the given global island in sending order.
+  std::vector<std::string> inbox(const size_t island) const {
+    const std::string prefix = inboxPrefix(island);
+    std::vector<std::string> names;
+    if (DIR* dir = opendir(_directory.c_str())) {
+      while (const dirent* entry = readdir(dir)) {
+        const std::string name(entry->d_name);
+        if (name.compare(0, prefix.size(), prefix) == 0 && name.size() > 5 &&
+            name.compare(name.size() - 5, 5, ".part") == 0) {
+          names.push_back(name);
+        }
+      }
+      closedir(dir);
+    }
+    std::sort(names.begin(), names.end());
+    return names;
+  }
+
+  bool read(const std::string& filename, std::vector<PartitionID>& partition) const {
+    std::ifstream file(filename, std::ios::binary);
+    uint64_t magic = 0;
+    int32_t k = 0;
+    file.read(reinterpret_cast<char*>(&magic), sizeof(magic));
+    file.read(reinterpret_cast<char*>(&k), sizeof(k));
+    ds::PackedIntegerArray packed;
+    if (!file || magic != kMagic || k != _k ||
+        !packed.read(file, _num_nodes, static_cast<uint32_t>(_k - 1))) {
+      return false;
+    }
+    partition.resize(packed.size());
+    for (size_t i = 0; i < packed.size(); ++i) {
+      partition[i] = static_cast<PartitionID>(packed.get(i));
+      if (partition[i] >= _k) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  const std::string _directory;
+  const size_t _first_island;
+  const size_t _num_islands;
+  const size_t _num_global_islands;
+  const size_t _capacity;
+  const HypernodeID _num_nodes;
+  const PartitionID _k;
+  std::mutex _mutex;
+  uint64_t _sequence_number;
+};
+
+inline std::unique_ptr<Migration> createMigration(const Context& context,
+                                                  const HypernodeID num_nodes) {
+  const size_t capacity = std::max(context.evolutionary.num_migrants, static_cast<size_t>(1));
+  if (context.evolutionary.migration_directory.empty()) {
+    return std::unique_ptr<Migration>(new LocalMigration(context.evolutionary.num_islands,
+                                                         capacity));
+  }
+  return std::unique_ptr<Migration>(new FileMigration(context.evolutionary.migration_directory,
+                                                      context.evolutionary.process_id,
+                                                      context.evolutionary.num_processes,
+                                                      context.evolutionary.num_islands,
+                                                      capacity, num_nodes,
+                                                      context.partition.k));
+}
+}  // namespace kahypar
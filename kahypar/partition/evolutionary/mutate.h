@@ -33,7 +33,7 @@ static constexpr bool debug = false;
 Individual vCycleWithNewInitialPartitioning(Hypergraph& hg, const Individual& in,
                                             const Context& context) {
   const HighResClockTimepoint start = std::chrono::high_resolution_clock::now();
-  hg.reset();
+  // setPartition resets the hypergraph
   hg.setPartition(in.partition());
   Context temporary_context(context);
   temporary_context.evolutionary.action =
@@ -60,7 +60,7 @@ Individual vCycleWithNewInitialPartitioning(Hypergraph& hg, const Individual& in
 Individual vCycle(Hypergraph& hg, const Individual& in,
                   const Context& context) {
   const HighResClockTimepoint start = std::chrono::high_resolution_clock::now();
-  hg.reset();
+  // setPartition resets the hypergraph
   hg.setPartition(in.partition());
   Context temporary_context(context);
   temporary_context.evolutionary.action =
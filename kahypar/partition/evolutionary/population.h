@@ -28,6 +28,7 @@
 #include "kahypar/partition/evolutionary/individual.h"
 #include "kahypar/partition/metrics.h"
 #include "kahypar/partition/partitioner.h"
+#include "kahypar/utils/memory_tracker.h"
 #include "kahypar/utils/randomize.h"
 
 namespace kahypar {
@@ -37,7 +38,9 @@ class Population {
 
  public:
   explicit Population() :
-    _individuals() { }
+    _individuals(),
+    _ids(),
+    _next_id(0) { }
 
   inline size_t insert(Individual&& individual, const Context& context) {
     DBG << context.evolutionary.replace_strategy;
@@ -57,12 +60,14 @@ class Population {
   inline size_t forceInsert(Individual&& individual, const size_t position) {
     DBG << V(position) << V(individual.fitness());
     _individuals[position] = std::move(individual);
+    _ids[position] = nextId();
     return position;
   }
   inline size_t forceInsertSaveBest(Individual&& individual, const size_t position) {
     DBG << V(position) << V(individual.fitness());
     if (individual.fitness() <= _individuals[position].fitness() || position != best()) {
       _individuals[position] = std::move(individual);
+      _ids[position] = nextId();
     }
     return position;
   }
@@ -98,6 +103,7 @@ class Population {
     hg.reset();
     partitioner.partition(hg, context);
     _individuals.emplace_back(Individual(hg, context));
+    _ids.push_back(nextId());
     if (_individuals.size() > context.evolutionary.population_size) {
       std::cout << "Error, tried to fill Population above limit" << std::endl;
       std::exit(1);
@@ -109,9 +115,23 @@ class Population {
     return _individuals.back();
   }
 
+  inline void add(Individual&& individual) {
+    _individuals.push_back(std::move(individual));
+    _ids.push_back(nextId());
+  }
+
   inline size_t size() const {
     return _individuals.size();
   }
+
+  inline size_t sizeInBytes() const {
+    size_t bytes = _individuals.capacity() * sizeof(Individual) +
+                   _ids.capacity() * sizeof(size_t);
+    for (const Individual& individual : _individuals) {
+      bytes += individual.sizeInBytes();
+    }
+    return bytes;
+  }
   inline size_t randomIndividual() const {
     return Randomize::instance().getRandomInt(0, size() - 1);
   }
@@ -174,21 +194,28 @@ class Population {
     return _individuals[pos];
   }
 
-  inline Individuals listOfBest(const size_t& amount) const {
-    std::vector<std::pair<HyperedgeWeight, size_t> > sorting;
-    for (size_t i = 0; i < _individuals.size(); ++i) {
-      sorting.push_back(std::make_pair(_individuals[i].fitness(), i));
-    }
-
-    std::partial_sort(sorting.begin(), sorting.begin() + amount, sorting.end());
+  // Ids are unique within the population and change whenever an individual is replaced.
+  inline size_t idAt(const size_t pos) const {
+    return _ids[pos];
+  }
 
+  inline Individuals listOfBest(const size_t& amount) const {
     Individuals best_individuals;
-    for (size_t i = 0; i < amount; ++i) {
-      best_individuals.push_back(_individuals[sorting[i].second]);
+    for (const size_t pos : positionsOfBest(amount)) {
+      best_individuals.push_back(_individuals[pos]);
     }
     return best_individuals;
   }
 
+  // Ids of the individuals returned by listOfBest in the same order.
+  inline std::vector<size_t> idsOfBest(const size_t& amount) const {
+    std::vector<size_t> best_ids;
+    for (const size_t pos : positionsOfBest(amount)) {
+      best_ids.push_back(_ids[pos]);
+    }
+    return best_ids;
+  }
+
   inline void print() const {
     std::cout << std::endl << "Population Fitness: ";
     for (size_t i = 0; i < _individuals.size(); ++i) {
@@ -203,33 +230,31 @@ class Population {
   }
   inline size_t difference(const Individual& individual, const size_t position,
                            const bool strong_set) const {
-    std::vector<HyperedgeID> output_diff;
-    if (strong_set) {
-      ASSERT(std::is_sorted(_individuals[position].strongCutEdges().begin(),
-                            _individuals[position].strongCutEdges().end()));
-      ASSERT(std::is_sorted(individual.strongCutEdges().begin(),
-                            individual.strongCutEdges().end()));
-      std::set_symmetric_difference(_individuals[position].strongCutEdges().begin(),
-                                    _individuals[position].strongCutEdges().end(),
-                                    individual.strongCutEdges().begin(),
-                                    individual.strongCutEdges().end(),
-                                    std::back_inserter(output_diff));
-    } else {
-      ASSERT(std::is_sorted(_individuals[position].cutEdges().begin(),
-                            _individuals[position].cutEdges().end()));
-      ASSERT(std::is_sorted(individual.cutEdges().begin(),
-                            individual.cutEdges().end()));
-      std::set_symmetric_difference(_individuals[position].cutEdges().begin(),
-                                    _individuals[position].cutEdges().end(),
-                                    individual.cutEdges().begin(),
-                                    individual.cutEdges().end(),
-                                    std::back_inserter(output_diff));
-    }
-    DBG << V(output_diff.size());
-    return output_diff.size();
+    const size_t difference = _individuals[position].difference(individual, strong_set);
+    DBG << V(difference);
+    return difference;
   }
 
  private:
+  inline size_t nextId() {
+    return _next_id++;
+  }
+
+  inline std::vector<size_t> positionsOfBest(const size_t amount) const {
+    std::vector<std::pair<HyperedgeWeight, size_t> > sorting;
+    for (size_t i = 0; i < _individuals.size(); ++i) {
+      sorting.push_back(std::make_pair(_individuals[i].fitness(), i));
+    }
+
+    std::partial_sort(sorting.begin(), sorting.begin() + amount, sorting.end());
+
+    std::vector<size_t> positions;
+    for (size_t i = 0; i < amount; ++i) {
+      positions.push_back(sorting[i].second);
+    }
+    return positions;
+  }
+
   inline size_t replaceDiverse(Individual&& individual, const bool strong_set) {
     size_t max_similarity = std::numeric_limits<size_t>::max();
     size_t max_similarity_id = 0;
@@ -253,6 +278,8 @@ class Population {
   }
 
   std::vector<Individual> _individuals;
+  std::vector<size_t> _ids;
+  size_t _next_id;
 };
 std::ostream& operator<< (std::ostream& os, const Population& population) {
   for (size_t i = 0; i < population.size(); ++i) {
@@ -30,6 +30,7 @@
 #include "kahypar/partition/coarsening/policies/rating_acceptance_policy.h"
 #include "kahypar/partition/coarsening/policies/rating_community_policy.h"
 #include "kahypar/partition/coarsening/policies/rating_heavy_node_penalty_policy.h"
+#include "kahypar/partition/coarsening/policies/rating_queue_policy.h"
 #include "kahypar/partition/coarsening/policies/rating_score_policy.h"
 #include "kahypar/partition/initial_partitioning/i_initial_partitioner.h"
 #include "kahypar/partition/refinement/2way_fm_refiner.h"
@@ -54,17 +55,47 @@ using RatingPolicies = meta::Typelist<RatingScorePolicies, HeavyNodePenaltyPolic
                                       CommunityPolicies, PartitionPolicies, AcceptancePolicies,
                                       FixedVertexAcceptancePolicies>;
 
+// Vertex pair coarseners additionally choose the priority queue used to order ratings.
+using VertexPairRatingPolicies = meta::Typelist<RatingScorePolicies, HeavyNodePenaltyPolicies,
+                                                CommunityPolicies, PartitionPolicies,
+                                                AcceptancePolicies, FixedVertexAcceptancePolicies,
+                                                RatingQueuePolicies>;
+
+template <class ScorePolicy, class HeavyNodePenaltyPolicy, class CommunityPolicy,
+          class RatingPartitionPolicy, class AcceptancePolicy, class FixedVertexPolicy,
+          class RatingQueuePolicy>
+using FullVertexPairCoarsenerWithQueue = FullVertexPairCoarsener<ScorePolicy,
+                                                                 HeavyNodePenaltyPolicy,
+                                                                 CommunityPolicy,
+                                                                 RatingPartitionPolicy,
+                                                                 AcceptancePolicy,
+                                                                 FixedVertexPolicy,
+                                                                 RatingType,
+                                                                 RatingQueuePolicy>;
+
+template <class ScorePolicy, class HeavyNodePenaltyPolicy, class CommunityPolicy,
+          class RatingPartitionPolicy, class AcceptancePolicy, class FixedVertexPolicy,
+          class RatingQueuePolicy>
+using LazyVertexPairCoarsenerWithQueue = LazyVertexPairCoarsener<ScorePolicy,
+                                                                 HeavyNodePenaltyPolicy,
+                                                                 CommunityPolicy,
+                                                                 RatingPartitionPolicy,
+                                                                 AcceptancePolicy,
+                                                                 FixedVertexPolicy,
+                                                                 RatingType,
+                                                                 RatingQueuePolicy>;
+
 using MLCoarseningDispatcher = meta::StaticMultiDispatchFactory<MLCoarsener,
                                                                 ICoarsener,
                                                                 RatingPolicies>;
 
-using FullCoarseningDispatcher = meta::StaticMultiDispatchFactory<FullVertexPairCoarsener,
+using FullCoarseningDispatcher = meta::StaticMultiDispatchFactory<FullVertexPairCoarsenerWithQueue,
                                                                   ICoarsener,
-                                                                  RatingPolicies>;
+                                                                  VertexPairRatingPolicies>;
 
-using LazyCoarseningDispatcher = meta::StaticMultiDispatchFactory<LazyVertexPairCoarsener,
+using LazyCoarseningDispatcher = meta::StaticMultiDispatchFactory<LazyVertexPairCoarsenerWithQueue,
                                                                   ICoarsener,
-                                                                  RatingPolicies>;
+                                                                  VertexPairRatingPolicies>;
 
 using TwoWayFMFactoryDispatcher = meta::StaticMultiDispatchFactory<TwoWayFMRefiner,
                                                                    IRefiner,
@@ -27,6 +27,7 @@
 #include "kahypar/partition/context.h"
 #include "kahypar/partition/factories.h"
 #include "kahypar/partition/initial_partitioning/i_initial_partitioner.h"
+#include "kahypar/partition/time_budget.h"
 
 namespace kahypar {
 namespace partition {
@@ -172,7 +173,14 @@ static inline void partition(Hypergraph& hg, const Context& context) {
     extracted_init_hypergraph.first->resetPartitioning();
     // we do not want to use the community structure used during coarsening in initial partitioning
     extracted_init_hypergraph.first->resetCommunities();
+    if (context.initial_partitioning.race) {
+      context.initial_partitioning.race->reset();
+    }
     Context init_context = createContext(*extracted_init_hypergraph.first, context, init_alpha);
+    if (TimeBudget::isActive(context)) {
+      context.partition.time_budget->adaptInitialPartitioning(*extracted_init_hypergraph.first,
+                                                              init_context, context);
+    }
 
     if (context.initial_partitioning.verbose_output) {
       LOG << "Calling Initial Partitioner:" << context.initial_partitioning.technique
@@ -0,0 +1,95 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2019 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <vector>
+
+#include "kahypar/definitions.h"
+#include "kahypar/macros.h"
+#include "kahypar/meta/mandatory.h"
+
+namespace kahypar {
+/*!
+ * Collects the delta gain updates of a single move and applies them to the
+ * underlying k-way priority queue afterwards.
+ *
+ * The batch provides the part of the KWayPriorityQueue interface that is used by
+ * the gain computation policies. Updates of a hypernode that shares several nets with
+ * the moved hypernode are accumulated, such that each (hypernode, part) pair is updated
+ * at most once per move and updates that cancel each other out are skipped entirely.
+ */
+template <typename PQ = Mandatory>
+class DeltaGainBatch {
+ public:
+  DeltaGainBatch(PQ& pq, const HypernodeID num_nodes, const PartitionID k) :
+    _pq(pq),
+    _k(k),
+    _deltas(static_cast<size_t>(num_nodes) * k, 0),
+    _touched() { }
+
+  DeltaGainBatch(const DeltaGainBatch&) = delete;
+  DeltaGainBatch& operator= (const DeltaGainBatch&) = delete;
+
+  DeltaGainBatch(DeltaGainBatch&&) = delete;
+  DeltaGainBatch& operator= (DeltaGainBatch&&) = delete;
+
+  ~DeltaGainBatch() = default;
+
+  bool contains(const HypernodeID hn, const PartitionID part) const {
+    return _pq.contains(hn, part);
+  }
+
+  // Key including all pending updates
+  Gain key(const HypernodeID hn, const PartitionID part) const {
+    return _pq.key(hn, part) + _deltas[index(hn, part)];
+  }
+
+  void updateKeyBy(const HypernodeID hn, const PartitionID part, const Gain delta) {
+    ASSERT(_pq.contains(hn, part), V(hn) << V(part));
+    const size_t i = index(hn, part);
+    if (_deltas[i] == 0) {
+      _touched.push_back(i);
+    }
+    _deltas[i] += delta;
+  }
+
+  void flush() {
+    for (const size_t i : _touched) {
+      // Entries that dropped back to zero in between may occur twice.
+      if (_deltas[i] != 0) {
+        _pq.updateKeyBy(i / _k, i % _k, _deltas[i]);
+        _deltas[i] = 0;
+      }
+    }
+    _touched.clear();
+  }
+
+ private:
+  size_t index(const HypernodeID hn, const PartitionID part) const {
+    return static_cast<size_t>(hn) * _k + part;
+  }
+
+  PQ& _pq;
+  const PartitionID _k;
+  std::vector<Gain> _deltas;
+  std::vector<size_t> _touched;
+};
+}  // namespace kahypar
@@ -26,32 +26,35 @@
 #include <vector>
 
 #include "kahypar/datastructure/fast_reset_flag_array.h"
-#include "kahypar/datastructure/kway_priority_queue.h"
 #include "kahypar/definitions.h"
 #include "kahypar/meta/mandatory.h"
+#include "kahypar/partition/initial_partitioning/delta_gain_batch.h"
 #include "kahypar/partition/initial_partitioning/i_initial_partitioner.h"
 #include "kahypar/partition/initial_partitioning/initial_partitioner_base.h"
 #include "kahypar/partition/initial_partitioning/policies/ip_gain_computation_policy.h"
+#include "kahypar/partition/initial_partitioning/policies/ip_gain_queue_policy.h"
 #include "kahypar/utils/randomize.h"
 
 namespace kahypar {
 template <class StartNodeSelection = Mandatory,
           class GainComputation = Mandatory,
-          class QueueSelection = Mandatory>
+          class QueueSelection = Mandatory,
+          class GainQueuePolicy = BinaryHeapGainQueue>
 class GreedyHypergraphGrowingInitialPartitioner : public IInitialPartitioner,
                                                   private InitialPartitionerBase<
                                                     GreedyHypergraphGrowingInitialPartitioner<
                                                       StartNodeSelection,
                                                       GainComputation,
-                                                      QueueSelection> >{
+                                                      QueueSelection,
+                                                      GainQueuePolicy> >{
  private:
   static constexpr bool enable_heavy_assert = false;
 
-  using KWayRefinementPQ = ds::KWayPriorityQueue<HypernodeID, Gain,
-                                                 std::numeric_limits<Gain>, true>;
+  using KWayRefinementPQ = typename GainQueuePolicy::PriorityQueue;
   using Base = InitialPartitionerBase<GreedyHypergraphGrowingInitialPartitioner<StartNodeSelection,
                                                                                 GainComputation,
-                                                                                QueueSelection> >;
+                                                                                QueueSelection,
+                                                                                GainQueuePolicy> >;
   friend Base;
   static constexpr Gain InvalidGain = std::numeric_limits<Gain>::max() - 1;
 
@@ -60,10 +63,12 @@ class GreedyHypergraphGrowingInitialPartitioner : public IInitialPartitioner,
                                             Context& context) :
     Base(hypergraph, context),
     _pq(context.initial_partitioning.k),
+    _delta_gain_batch(_pq, GainQueuePolicy::batch_delta_gain_updates ? _hg.initialNumNodes() : 0,
+                      context.initial_partitioning.k),
     _visit(_hg.initialNumNodes()),
     _hyperedge_in_queue(static_cast<size_t>(context.initial_partitioning.k) *
                         _hg.initialNumEdges()) {
-    _pq.initialize(_hg.initialNumNodes());
+    GainQueuePolicy::template initialize<GainComputation>(_pq, _hg);
   }
 
   ~GreedyHypergraphGrowingInitialPartitioner() override = default;
@@ -74,6 +79,11 @@ class GreedyHypergraphGrowingInitialPartitioner : public IInitialPartitioner,
   GreedyHypergraphGrowingInitialPartitioner(GreedyHypergraphGrowingInitialPartitioner&&) = delete;
   GreedyHypergraphGrowingInitialPartitioner& operator= (GreedyHypergraphGrowingInitialPartitioner&&) = delete;
 
+  // Returns false, if the gains of the hypergraph exceed the range supported by the gain queue.
+  static bool isGainQueueApplicable(const Hypergraph& hypergraph) {
+    return GainQueuePolicy::template isApplicable<GainComputation>(hypergraph);
+  }
+
  private:
   FRIEND_TEST(AGreedyHypergraphGrowingFunctionalityTest, InsertionOfAHypernodeIntoPQ);
   FRIEND_TEST(AGreedyHypergraphGrowingFunctionalityTest,
@@ -304,9 +314,16 @@ class GreedyHypergraphGrowingInitialPartitioner : public IInitialPartitioner,
   void insertAndUpdateNodesAfterMove(const HypernodeID hn, const PartitionID target_part,
                                      const bool insert = true, const bool delete_nodes = true) {
     if (!_hg.isFixedVertex(hn)) {
-      GainComputation::deltaGainUpdate(_hg, _context, _pq, hn,
-                                       _context.initial_partitioning.unassigned_part, target_part,
-                                       _visit);
+      if (GainQueuePolicy::batch_delta_gain_updates) {
+        GainComputation::deltaGainUpdate(_hg, _context, _delta_gain_batch, hn,
+                                         _context.initial_partitioning.unassigned_part, target_part,
+                                         _visit);
+        _delta_gain_batch.flush();
+      } else {
+        GainComputation::deltaGainUpdate(_hg, _context, _pq, hn,
+                                         _context.initial_partitioning.unassigned_part, target_part,
+                                         _visit);
+      }
     }
     // Pushing incident hypernode into bucket queue or update gain value
     // TODO(heuer): Shouldn't it be possible to do this within the deltaGainUpdate function?
@@ -406,6 +423,7 @@ class GreedyHypergraphGrowingInitialPartitioner : public IInitialPartitioner,
   using Base::_context;
   using Base::kInvalidNode;
   KWayRefinementPQ _pq;
+  DeltaGainBatch<KWayRefinementPQ> _delta_gain_batch;
   ds::FastResetFlagArray<> _visit;
   ds::FastResetFlagArray<> _hyperedge_in_queue;
 };
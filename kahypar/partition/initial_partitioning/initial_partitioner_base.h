@@ -21,8 +21,10 @@
 #pragma once
 
 #include <algorithm>
+#include <atomic>
 #include <limits>
 #include <map>
+#include <memory>
 #include <stack>
 #include <vector>
 
@@ -35,6 +37,9 @@
 #include "kahypar/partition/refinement/kway_fm_cut_refiner.h"
 #include "kahypar/partition/refinement/policies/fm_improvement_policy.h"
 #include "kahypar/partition/refinement/policies/fm_stop_policy.h"
+#include "kahypar/utils/parallel.h"
+#include "kahypar/utils/randomize.h"
+#include "kahypar/utils/trace.h"
 
 namespace kahypar {
 template <typename Derived = Mandatory>
@@ -97,11 +102,20 @@ class InitialPartitionerBase {
   }
 
   void multipleRunsInitialPartitioning() {
+    if (performsParallelRuns()) {
+      parallelMultipleRunsInitialPartitioning();
+      return;
+    }
     Objective obj = _context.partition.objective;
     HyperedgeWeight best_quality = std::numeric_limits<HyperedgeWeight>::max();
     double best_imbalance = std::numeric_limits<double>::max();
     std::vector<PartitionID> best_partition(_hg.initialNumNodes(), 0);
     for (uint32_t i = 0; i < _context.initial_partitioning.nruns; ++i) {
+      if (i > 0 && _context.isCancelled()) {
+        break;
+      }
+      TraceSpan span(_context.partition.trace_recorder, "ip_trial", "initial_partitioning");
+      span.arg("run", i);
       // hg.resetPartitioning() is called in initial_partition
       static_cast<Derived*>(this)->initialPartition();
 
@@ -109,16 +123,9 @@ class InitialPartitionerBase {
                                               metrics::hyperedgeCut(_hg) : metrics::km1(_hg);
       const double current_imbalance = metrics::imbalance(_hg, _context);
       DBG << V(obj) << V(current_quality) << V(current_imbalance);
+      reportToRace(current_quality, current_imbalance);
 
-      const bool equal_metric = current_quality == best_quality;
-      const bool improved_metric = current_quality < best_quality;
-      const bool improved_imbalance = current_imbalance < best_imbalance;
-      const bool is_feasible_partition = current_imbalance <= _context.partition.epsilon;
-      const bool is_best_cut_feasible_paritition = best_imbalance <= _context.partition.epsilon;
-
-      if ((improved_metric && (is_feasible_partition || improved_imbalance)) ||
-          (equal_metric && improved_imbalance) ||
-          (is_feasible_partition && !is_best_cut_feasible_paritition)) {
+      if (isBetterPartition(current_quality, current_imbalance, best_quality, best_imbalance)) {
         best_quality = current_quality;
         best_imbalance = current_imbalance;
         for (const HypernodeID& hn : _hg.nodes()) {
@@ -127,24 +134,11 @@ class InitialPartitionerBase {
       }
     }
 
-    _hg.resetPartitioning();
-    for (const HypernodeID& hn : _hg.nodes()) {
-      _hg.setNodePart(hn, best_partition[hn]);
-    }
-
-    ASSERT([&]() {
-        for (const HypernodeID& hn : _hg.fixedVertices()) {
-          if (_hg.partID(hn) != _hg.fixedVertexPartID(hn)) {
-            LOG << V(hn) << V(_hg.partID(hn)) << V(_hg.fixedVertexPartID(hn));
-            return false;
-          }
-        }
-        return true;
-      } (), "Fixed Vertices are not correctly assigned!");
+    applyPartition(best_partition);
   }
 
   void performFMRefinement() {
-    if (_context.initial_partitioning.refinement) {
+    if (_context.initial_partitioning.refinement && !losesRace() && !_context.isCancelled()) {
       std::unique_ptr<IRefiner> refiner;
       if (_context.local_search.algorithm == RefinementAlgorithm::twoway_fm &&
           _context.initial_partitioning.k > 2) {
@@ -281,10 +275,161 @@ class InitialPartitionerBase {
   }
 
  protected:
+  struct TrialResult {
+    HyperedgeWeight quality = 0;
+    double imbalance = 0.0;
+    std::vector<PartitionID> partition { };
+  };
+
+  bool isBetterPartition(const HyperedgeWeight quality, const double imbalance,
+                         const HyperedgeWeight best_quality, const double best_imbalance) const {
+    const bool equal_metric = quality == best_quality;
+    const bool improved_metric = quality < best_quality;
+    const bool improved_imbalance = imbalance < best_imbalance;
+    const bool is_feasible_partition = imbalance <= _context.partition.epsilon;
+    const bool is_best_cut_feasible_paritition = best_imbalance <= _context.partition.epsilon;
+
+    return (improved_metric && (is_feasible_partition || improved_imbalance)) ||
+           (equal_metric && improved_imbalance) ||
+           (is_feasible_partition && !is_best_cut_feasible_paritition);
+  }
+
+  // Executes each of the given initial partitioning algorithms as an independent trial.
+  // After cancellation, all trials except the first one are skipped.
+  // The trials are distributed dynamically among initial_partitioning.num_threads workers.
+  // Each worker partitions its own copy of the hypergraph and each trial uses its own
+  // partitioner instance and seed. Therefore the results do not depend on the number
+  // of threads, unless racing is enabled: Whether a trial skips its local search then
+  // depends on the results the other trials reported so far.
+  std::vector<TrialResult> performParallelTrials(
+    const std::vector<InitialPartitionerAlgorithm>& algorithms) {
+    ASSERT(_hg.currentNumNodes() == _hg.initialNumNodes(),
+           "Initial partitioning expects a reindexed hypergraph");
+    std::vector<int> seeds;
+    for (size_t i = 0; i < algorithms.size(); ++i) {
+      seeds.push_back(Randomize::instance().newRandomSeed());
+    }
+    // The calling thread also executes trials, which reseeds its random number generator
+    const int next_seed = Randomize::instance().newRandomSeed();
+
+    // The contexts of the trials are created and destroyed by the calling thread,
+    // because copies of a context serialize their stats to the original on destruction.
+    std::vector<Context> contexts;
+    contexts.reserve(algorithms.size());
+    for (size_t trial = 0; trial < algorithms.size(); ++trial) {
+      contexts.emplace_back(_context);
+      contexts.back().initial_partitioning.nruns = 1;
+      contexts.back().initial_partitioning.num_threads = 1;
+    }
+
+    std::vector<TrialResult> results(algorithms.size());
+    std::atomic<size_t> next_trial(0);
+    const size_t num_workers = std::min(_context.initial_partitioning.num_threads,
+                                        algorithms.size());
+    parallel::forEachChunk(num_workers, num_workers,
+                           [&](const size_t, const size_t, const size_t) {
+        std::unique_ptr<Hypergraph> hypergraph = ds::reindex(_hg).first;
+        for (size_t trial = next_trial++; trial < algorithms.size(); trial = next_trial++) {
+          if (trial > 0 && _context.isCancelled()) {
+            // skipped trials are never better than an executed one
+            results[trial].quality = std::numeric_limits<HyperedgeWeight>::max();
+            results[trial].imbalance = std::numeric_limits<double>::max();
+            continue;
+          }
+          TraceSpan span(_context.partition.trace_recorder, "ip_trial", "initial_partitioning");
+          span.arg("algorithm", algorithms[trial]).arg("trial", trial);
+          Context& context = contexts[trial];
+          hypergraph->resetPartitioning();
+          Randomize::instance().setSeed(seeds[trial]);
+          std::unique_ptr<IInitialPartitioner> partitioner(
+            InitialPartitioningFactory::getInstance().createObject(algorithms[trial],
+                                                                   *hypergraph, context));
+          partitioner->partition();
+
+          TrialResult& result = results[trial];
+          result.quality = context.partition.objective == Objective::cut ?
+                           metrics::hyperedgeCut(*hypergraph) : metrics::km1(*hypergraph);
+          result.imbalance = metrics::imbalance(*hypergraph, context);
+          if (context.initial_partitioning.race) {
+            context.initial_partitioning.race->report(
+              result.quality, result.imbalance <= context.partition.epsilon);
+          }
+          result.partition.resize(hypergraph->initialNumNodes());
+          for (const HypernodeID& hn : hypergraph->nodes()) {
+            result.partition[hn] = hypergraph->partID(hn);
+          }
+          DBG << algorithms[trial] << V(result.quality) << V(result.imbalance);
+        }
+      });
+
+    Randomize::instance().setSeed(next_seed);
+    return results;
+  }
+
   Hypergraph& _hg;
   Context& _context;
 
  private:
+  void reportToRace(const HyperedgeWeight quality, const double imbalance) const {
+    if (_context.initial_partitioning.race) {
+      _context.initial_partitioning.race->report(quality,
+                                                 imbalance <= _context.partition.epsilon);
+    }
+  }
+
+  // In racing mode, a trial is abandoned before local search if its current
+  // partition cannot beat the best feasible partition of the other trials.
+  bool losesRace() const {
+    if (!_context.initial_partitioning.race) {
+      return false;
+    }
+    const HyperedgeWeight quality = _context.partition.objective == Objective::cut ?
+                                    metrics::hyperedgeCut(_hg) : metrics::km1(_hg);
+    const bool loses = _context.initial_partitioning.race->isHopeless(quality);
+    DBG << "Racing:" << V(quality) << V(loses)
+        << V(_context.initial_partitioning.race->bestFeasibleQuality());
+    return loses;
+  }
+
+  bool performsParallelRuns() const {
+    // The pool initial partitioner parallelizes over its algorithms instead.
+    return _context.initial_partitioning.num_threads > 1 &&
+           _context.initial_partitioning.nruns > 1 &&
+           _context.initial_partitioning.algo != InitialPartitionerAlgorithm::pool &&
+           _context.initial_partitioning.algo != InitialPartitionerAlgorithm::UNDEFINED;
+  }
+
+  void parallelMultipleRunsInitialPartitioning() {
+    const std::vector<TrialResult> results = performParallelTrials(
+      std::vector<InitialPartitionerAlgorithm>(_context.initial_partitioning.nruns,
+                                               _context.initial_partitioning.algo));
+    size_t best = 0;
+    for (size_t i = 1; i < results.size(); ++i) {
+      if (isBetterPartition(results[i].quality, results[i].imbalance,
+                            results[best].quality, results[best].imbalance)) {
+        best = i;
+      }
+    }
+    applyPartition(results[best].partition);
+  }
+
+  void applyPartition(const std::vector<PartitionID>& partition) {
+    _hg.resetPartitioning();
+    for (const HypernodeID& hn : _hg.nodes()) {
+      _hg.setNodePart(hn, partition[hn]);
+    }
+
+    ASSERT([&]() {
+        for (const HypernodeID& hn : _hg.fixedVertices()) {
+          if (_hg.partID(hn) != _hg.fixedVertexPartID(hn)) {
+            LOG << V(hn) << V(_hg.partID(hn)) << V(_hg.fixedVertexPartID(hn));
+            return false;
+          }
+        }
+        return true;
+      } (), "Fixed Vertices are not correctly assigned!");
+  }
+
   void preassignAllFixedVertices() {
     for (const HypernodeID& hn : _hg.fixedVertices()) {
       ASSERT(_hg.partID(hn) == -1, "Fixed vertex already assigned to part");
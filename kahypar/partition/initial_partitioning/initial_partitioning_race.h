@@ -0,0 +1,124 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2019 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <atomic>
+#include <limits>
+#include <mutex>
+#include <vector>
+
+#include "kahypar/definitions.h"
+#include "kahypar/partition/context_enum_classes.h"
+
+namespace kahypar {
+/*!
+ * Shared state of the initial partitioning trials in racing mode.
+ *
+ * All trials of one initial partitioning call report their results to the race.
+ * A trial whose unrefined partition is worse than the best feasible result seen so far
+ * by more than the given margin is abandoned before local search. Additionally, the
+ * race remembers which algorithms of the pool lost, i.e., produced a result that is
+ * worse than the best result of the call by more than the margin. Algorithms that lost
+ * patience times in a row are skipped in subsequent calls and are only re-evaluated
+ * every patience-th call.
+ *
+ * Note that racing makes initial partitioning nondeterministic if trials run in
+ * parallel: Whether a trial is abandoned depends on which other trials already
+ * reported their results, which in turn depends on thread scheduling.
+ */
+class InitialPartitioningRace {
+  static constexpr HyperedgeWeight kInvalidQuality = std::numeric_limits<HyperedgeWeight>::max();
+
+ public:
+  InitialPartitioningRace(const double margin, const uint32_t patience) :
+    _margin(margin),
+    _patience(patience),
+    _best_feasible_quality(kInvalidQuality),
+    _mutex(),
+    _consecutive_losses(kNumAlgorithms, 0),
+    _skipped(kNumAlgorithms, 0) { }
+
+  InitialPartitioningRace(const InitialPartitioningRace&) = delete;
+  InitialPartitioningRace& operator= (const InitialPartitioningRace&) = delete;
+
+  InitialPartitioningRace(InitialPartitioningRace&&) = delete;
+  InitialPartitioningRace& operator= (InitialPartitioningRace&&) = delete;
+
+  ~InitialPartitioningRace() = default;
+
+  // Has to be called before the trials of a new initial partitioning call start.
+  void reset() {
+    _best_feasible_quality = kInvalidQuality;
+  }
+
+  void report(const HyperedgeWeight quality, const bool is_feasible) {
+    if (!is_feasible) {
+      return;
+    }
+    HyperedgeWeight best = _best_feasible_quality.load();
+    while (quality < best && !_best_feasible_quality.compare_exchange_weak(best, quality)) { }
+  }
+
+  bool isHopeless(const HyperedgeWeight quality) const {
+    const HyperedgeWeight best = _best_feasible_quality.load();
+    return best != kInvalidQuality && quality > best + _margin * best;
+  }
+
+  HyperedgeWeight bestFeasibleQuality() const {
+    return _best_feasible_quality.load();
+  }
+
+  bool shouldRun(const InitialPartitionerAlgorithm algo) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    const size_t i = static_cast<size_t>(algo);
+    if (_consecutive_losses[i] < _patience) {
+      return true;
+    }
+    if (++_skipped[i] >= _patience) {
+      _skipped[i] = 0;
+      return true;
+    }
+    return false;
+  }
+
+  // Should only be called for algorithms that actually ran in the current call.
+  void recordResult(const InitialPartitionerAlgorithm algo,
+                    const HyperedgeWeight quality, const bool is_feasible,
+                    const HyperedgeWeight best_quality, const bool best_is_feasible) {
+    const bool lost = (best_is_feasible && !is_feasible) ||
+                      quality > best_quality + _margin * best_quality;
+    std::lock_guard<std::mutex> lock(_mutex);
+    const size_t i = static_cast<size_t>(algo);
+    _consecutive_losses[i] = lost ? _consecutive_losses[i] + 1 : 0;
+  }
+
+ private:
+  static constexpr size_t kNumAlgorithms =
+    static_cast<size_t>(InitialPartitionerAlgorithm::UNDEFINED) + 1;
+
+  const double _margin;
+  const uint32_t _patience;
+  std::atomic<HyperedgeWeight> _best_feasible_quality;
+  std::mutex _mutex;
+  std::vector<uint32_t> _consecutive_losses;
+  std::vector<uint32_t> _skipped;
+};
+}  // namespace kahypar
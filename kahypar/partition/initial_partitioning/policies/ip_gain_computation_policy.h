@@ -40,8 +40,25 @@ enum class GainType : std::uint8_t {
   max_pin_gain
 };
 
+// Upper bound for the absolute value of FM and max-net gains.
+static inline Gain maxWeightedDegree(const Hypergraph& hg) {
+  Gain max_weighted_degree = 0;
+  for (const HypernodeID& hn : hg.nodes()) {
+    Gain weighted_degree = 0;
+    for (const HyperedgeID& he : hg.incidentEdges(hn)) {
+      weighted_degree += hg.edgeWeight(he);
+    }
+    max_weighted_degree = std::max(max_weighted_degree, weighted_degree);
+  }
+  return max_weighted_degree;
+}
+
 class FMGainComputationPolicy {
  public:
+  static inline Gain maxGain(const Hypergraph& hg) {
+    return maxWeightedDegree(hg);
+  }
+
   static inline Gain calculateGainForUnassignedHN(const Hypergraph& hg,
                                                   const HypernodeID& hn,
                                                   const PartitionID& target_part) {
@@ -292,6 +309,23 @@ class FMGainComputationPolicy {
 
 class MaxPinGainComputationPolicy {
  public:
+  // The gain is bounded by the weight of the neighborhood of a hypernode.
+  static inline Gain maxGain(const Hypergraph& hg) {
+    const int64_t max_node_weight = hg.weightOfHeaviestNode();
+    Gain max_gain = 0;
+    for (const HypernodeID& hn : hg.nodes()) {
+      int64_t max_neighborhood_weight = 0;
+      for (const HyperedgeID& he : hg.incidentEdges(hn)) {
+        max_neighborhood_weight += hg.edgeSize(he) * max_node_weight;
+        if (max_neighborhood_weight >= hg.totalWeight()) {
+          return hg.totalWeight();
+        }
+      }
+      max_gain = std::max(max_gain, static_cast<Gain>(max_neighborhood_weight));
+    }
+    return max_gain;
+  }
+
   static inline Gain calculateGain(const Hypergraph& hg, const HypernodeID& hn,
                                    const PartitionID& target_part,
                                    ds::FastResetFlagArray<>& visit) {
@@ -352,6 +386,10 @@ class MaxPinGainComputationPolicy {
 
 class MaxNetGainComputationPolicy {
  public:
+  static inline Gain maxGain(const Hypergraph& hg) {
+    return maxWeightedDegree(hg);
+  }
+
   static inline Gain calculateGain(const Hypergraph& hg, const HypernodeID& hn,
                                    const PartitionID& target_part,
                                    const ds::FastResetFlagArray<>&) {
@@ -0,0 +1,78 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2019 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <limits>
+
+#include "kahypar/datastructure/binary_heap.h"
+#include "kahypar/datastructure/integer_bucket_queue.h"
+#include "kahypar/datastructure/kway_priority_queue.h"
+#include "kahypar/definitions.h"
+
+namespace kahypar {
+class BinaryHeapGainQueue {
+ public:
+  using PriorityQueue = ds::KWayPriorityQueue<HypernodeID, Gain,
+                                              std::numeric_limits<Gain>, true,
+                                              ds::BinaryMaxHeap<HypernodeID, Gain> >;
+  static constexpr bool batch_delta_gain_updates = false;
+
+  template <class GainComputation>
+  static inline void initialize(PriorityQueue& pq, const Hypergraph& hg) {
+    pq.initialize(hg.initialNumNodes());
+  }
+
+  template <class GainComputation>
+  static inline bool isApplicable(const Hypergraph&) {
+    return true;
+  }
+};
+
+// Constant time gain updates. Gains have to be within [-max_gain, max_gain].
+// The delta gain updates of a move are accumulated and each (hypernode, part) pair
+// is updated at most once.
+class IntegerBucketGainQueue {
+ public:
+  using PriorityQueue = ds::KWayPriorityQueue<HypernodeID, Gain,
+                                              std::numeric_limits<Gain>, true,
+                                              ds::IntegerBucketMaxQueue<HypernodeID, Gain> >;
+  static constexpr bool batch_delta_gain_updates = true;
+
+  template <class GainComputation>
+  static inline void initialize(PriorityQueue& pq, const Hypergraph& hg) {
+    pq.initialize(hg.initialNumNodes(), GainComputation::maxGain(hg));
+  }
+
+  // The buckets of each queue should not need more memory than the binary heap
+  // would need for its elements.
+  template <class GainComputation>
+  static inline bool isApplicable(const Hypergraph& hg) {
+    const Gain max_gain = GainComputation::maxGain(hg);
+    const size_t min_num_buckets = kMinNumBuckets;
+    return 2 * static_cast<size_t>(max_gain) + 1 <=
+           std::max(static_cast<size_t>(hg.initialNumNodes()), min_num_buckets);
+  }
+
+ private:
+  static constexpr size_t kMinNumBuckets = 1024;
+};
+}  // namespace kahypar
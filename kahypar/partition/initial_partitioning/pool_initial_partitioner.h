@@ -20,8 +20,11 @@
 
 #pragma once
 
+#include <algorithm>
 #include <limits>
+#include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "kahypar/definitions.h"
@@ -30,6 +33,7 @@
 #include "kahypar/partition/initial_partitioning/initial_partitioner_base.h"
 #include "kahypar/partition/partitioner.h"
 #include "kahypar/utils/randomize.h"
+#include "kahypar/utils/trace.h"
 
 namespace kahypar {
 class PoolInitialPartitioner : public IInitialPartitioner,
@@ -118,39 +122,43 @@ class PoolInitialPartitioner : public IInitialPartitioner,
     PartitioningResult max_imbalance(InitialPartitionerAlgorithm::pool, obj, kInvalidCut, -0.1);
 
     std::vector<PartitionID> best_partition(_hg.initialNumNodes());
-    unsigned int n = _partitioner_pool.size() - 1;
-    for (unsigned int i = 0; i <= n; ++i) {
-      // If the (n-i)th bit of pool_type is set we execute the corresponding
-      // initial partitioner (see constructor)
-      if (!((_context.initial_partitioning.pool_type >> (n - i)) & 1)) {
+    const std::vector<InitialPartitionerAlgorithm> algorithms = enabledAlgorithms();
+    std::vector<TrialResult> results;
+    std::vector<PartitioningResult> executed;
+    if (_context.initial_partitioning.num_threads > 1) {
+      results = performParallelPoolTrials(algorithms);
+    }
+    for (size_t i = 0; i < algorithms.size(); ++i) {
+      const InitialPartitionerAlgorithm algo = algorithms[i];
+      if (results.empty() ? i > 0 && _context.isCancelled() : results[i].partition.empty()) {
+        // skipped after cancellation
         continue;
       }
-      InitialPartitionerAlgorithm algo = _partitioner_pool[i];
-      if (algo == InitialPartitionerAlgorithm::greedy_round_maxpin ||
-          algo == InitialPartitionerAlgorithm::greedy_global_maxpin ||
-          algo == InitialPartitionerAlgorithm::greedy_sequential_maxpin) {
-        DBG << "skipping maxpin";
-        continue;
+      HyperedgeWeight current_quality = kInvalidCut;
+      double current_imbalance = kInvalidImbalance;
+      if (results.empty()) {
+        TraceSpan span(_context.partition.trace_recorder, "ip_algorithm", "initial_partitioning");
+        span.arg("algorithm", algo);
+        std::unique_ptr<IInitialPartitioner> partitioner(
+          InitialPartitioningFactory::getInstance().createObject(algo, _hg, _context));
+        partitioner->partition();
+        current_quality = obj == Objective::cut ? metrics::hyperedgeCut(_hg) : metrics::km1(_hg);
+        current_imbalance = metrics::imbalance(_hg, _context);
+      } else {
+        current_quality = results[i].quality;
+        current_imbalance = results[i].imbalance;
       }
-      std::unique_ptr<IInitialPartitioner> partitioner(
-        InitialPartitioningFactory::getInstance().createObject(algo, _hg, _context));
-      partitioner->partition();
-      HyperedgeWeight current_quality = obj == Objective::cut ?
-                                        metrics::hyperedgeCut(_hg) : metrics::km1(_hg);
-      double current_imbalance = metrics::imbalance(_hg, _context);
       DBG << algo << V(obj) << V(current_quality) << V(current_imbalance);
+      executed.emplace_back(algo, obj, current_quality, current_imbalance);
 
-      const bool equal_metric = current_quality == best_cut.quality;
-      const bool improved_metric = current_quality < best_cut.quality;
-      const bool improved_imbalance = current_imbalance < best_cut.imbalance;
-      const bool is_feasible_partition = current_imbalance <= _context.partition.epsilon;
-      const bool is_best_cut_feasible_paritition = best_cut.imbalance <= _context.partition.epsilon;
-
-      if ((improved_metric && (is_feasible_partition || improved_imbalance)) ||
-          (equal_metric && improved_imbalance) ||
-          (is_feasible_partition && !is_best_cut_feasible_paritition)) {
-        for (const HypernodeID& hn : _hg.nodes()) {
-          best_partition[hn] = _hg.partID(hn);
+      if (Base::isBetterPartition(current_quality, current_imbalance,
+                                  best_cut.quality, best_cut.imbalance)) {
+        if (results.empty()) {
+          for (const HypernodeID& hn : _hg.nodes()) {
+            best_partition[hn] = _hg.partID(hn);
+          }
+        } else {
+          best_partition.swap(results[i].partition);
         }
         applyPartitioningResults(best_cut, current_quality, current_imbalance, algo);
       }
@@ -168,6 +176,17 @@ class PoolInitialPartitioner : public IInitialPartitioner,
       }
     }
 
+    if (_context.initial_partitioning.race) {
+      const double epsilon = _context.partition.epsilon;
+      for (const PartitioningResult& result : executed) {
+        _context.initial_partitioning.race->recordResult(result.algo,
+                                                         result.quality,
+                                                         result.imbalance <= epsilon,
+                                                         best_cut.quality,
+                                                         best_cut.imbalance <= epsilon);
+      }
+    }
+
     if (_context.initial_partitioning.verbose_output) {
       min_cut.print_result("Minimum Quality  ");
       max_cut.print_result("Maximum Quality  ");
@@ -204,6 +223,68 @@ class PoolInitialPartitioner : public IInitialPartitioner,
     _context.initial_partitioning.nruns = 1;
   }
 
+  std::vector<InitialPartitionerAlgorithm> enabledAlgorithms() const {
+    std::vector<InitialPartitionerAlgorithm> algorithms;
+    unsigned int n = _partitioner_pool.size() - 1;
+    for (unsigned int i = 0; i <= n; ++i) {
+      // If the (n-i)th bit of pool_type is set we execute the corresponding
+      // initial partitioner (see constructor)
+      if (!((_context.initial_partitioning.pool_type >> (n - i)) & 1)) {
+        continue;
+      }
+      InitialPartitionerAlgorithm algo = _partitioner_pool[i];
+      if (algo == InitialPartitionerAlgorithm::greedy_round_maxpin ||
+          algo == InitialPartitionerAlgorithm::greedy_global_maxpin ||
+          algo == InitialPartitionerAlgorithm::greedy_sequential_maxpin) {
+        DBG << "skipping maxpin";
+        continue;
+      }
+      algorithms.push_back(algo);
+    }
+
+    if (_context.initial_partitioning.race) {
+      // Skip algorithms that kept losing in previous calls, but never skip all of them.
+      std::vector<InitialPartitionerAlgorithm> raced_algorithms;
+      for (const InitialPartitionerAlgorithm& algo : algorithms) {
+        if (_context.initial_partitioning.race->shouldRun(algo)) {
+          raced_algorithms.push_back(algo);
+        } else {
+          DBG << "Racing: skipping" << algo;
+        }
+      }
+      if (!raced_algorithms.empty()) {
+        algorithms.swap(raced_algorithms);
+      }
+    }
+    return algorithms;
+  }
+
+  // Executes all nruns trials of all algorithms in parallel and returns
+  // the best result of each algorithm.
+  std::vector<TrialResult> performParallelPoolTrials(
+    const std::vector<InitialPartitionerAlgorithm>& algorithms) {
+    const uint32_t nruns = std::max(_context.initial_partitioning.nruns, 1u);
+    std::vector<InitialPartitionerAlgorithm> trials;
+    for (const InitialPartitionerAlgorithm& algo : algorithms) {
+      trials.insert(trials.end(), nruns, algo);
+    }
+    std::vector<TrialResult> trial_results = Base::performParallelTrials(trials);
+
+    std::vector<TrialResult> results;
+    for (size_t i = 0; i < algorithms.size(); ++i) {
+      size_t best = i * nruns;
+      for (size_t run = best + 1; run < (i + 1) * nruns; ++run) {
+        if (Base::isBetterPartition(trial_results[run].quality, trial_results[run].imbalance,
+                                    trial_results[best].quality,
+                                    trial_results[best].imbalance)) {
+          best = run;
+        }
+      }
+      results.push_back(std::move(trial_results[best]));
+    }
+    return results;
+  }
+
   void applyPartitioningResults(PartitioningResult& result, const HyperedgeWeight quality,
                                 const double imbalance,
                                 const InitialPartitionerAlgorithm algo) const {
@@ -212,6 +293,7 @@ class PoolInitialPartitioner : public IInitialPartitioner,
     result.algo = algo;
   }
 
+  using TrialResult = typename Base::TrialResult;
   using Base::_hg;
   using Base::_context;
   std::vector<InitialPartitionerAlgorithm> _partitioner_pool;
@@ -255,6 +255,15 @@ static inline HyperedgeWeight correctMetric(const Hypergraph& hypergraph, const
   }
 }
 
+// Reports the quality of the current partition to the progress callback (if any).
+static inline void reportProgress(const Hypergraph& hypergraph, const Context& context,
+                                  const ProgressPhase phase) {
+  if (context.partition.control != nullptr) {
+    context.reportProgress(phase, correctMetric(hypergraph, context),
+                           imbalance(hypergraph, context));
+  }
+}
+
 static inline HyperedgeID hypernodeDegreePercentile(const Hypergraph& hypergraph, int percentile) {
   std::vector<HyperedgeID> hn_degrees;
   hn_degrees.reserve(hypergraph.currentNumNodes());
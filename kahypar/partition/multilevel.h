@@ -29,7 +29,10 @@
 #include "kahypar/partition/initial_partition.h"
 #include "kahypar/partition/metrics.h"
 #include "kahypar/partition/refinement/i_refiner.h"
+#include "kahypar/partition/time_budget.h"
+#include "kahypar/utils/memory_tracker.h"
 #include "kahypar/utils/timer.h"
+#include "kahypar/utils/trace.h"
 
 namespace kahypar {
 namespace multilevel {
@@ -39,13 +42,27 @@ static inline void partition(Hypergraph& hypergraph,
                              ICoarsener& coarsener,
                              IRefiner& refiner,
                              const Context& context) {
+  MemoryTracker::instance().report(MemoryComponent::hypergraph, hypergraph.sizeInBytes());
+  MemoryTracker::instance().report(MemoryComponent::pins_in_part,
+                                   hypergraph.pinsInPartSizeInBytes());
+
   io::printCoarseningBanner(context);
 
+  context.reportProgress(ProgressPhase::coarsening);
+  TraceSpan coarsening_span(context.partition.trace_recorder, "coarsening", "coarsening");
+  coarsening_span.arg("nodes", hypergraph.currentNumNodes());
+  const HypernodeID num_pins = hypergraph.currentNumPins();
   HighResClockTimepoint start = std::chrono::high_resolution_clock::now();
   coarsener.coarsen(context.coarsening.contraction_limit);
   HighResClockTimepoint end = std::chrono::high_resolution_clock::now();
+  coarsening_span.arg("coarse_nodes", hypergraph.currentNumNodes());
+  coarsening_span.end();
   Timer::instance().add(context, Timepoint::coarsening,
                         std::chrono::duration<double>(end - start).count());
+  if (TimeBudget::isActive(context)) {
+    context.partition.time_budget->recordCoarsening(
+      std::chrono::duration<double>(end - start).count(), num_pins);
+  }
 
   if (context.partition.verbose_output && context.type == ContextType::main) {
     io::printHypergraphInfo(hypergraph, "Coarsened Hypergraph");
@@ -56,10 +73,14 @@ static inline void partition(Hypergraph& hypergraph,
       hypergraph.reset();
     }
     io::printInitialPartitioningBanner(context);
+    context.reportProgress(ProgressPhase::initial_partitioning);
 
+    TraceSpan initial_partitioning_span(context.partition.trace_recorder,
+                                        "initial_partitioning", "initial_partitioning");
     start = std::chrono::high_resolution_clock::now();
     initial::partition(hypergraph, context);
     end = std::chrono::high_resolution_clock::now();
+    initial_partitioning_span.end();
     Timer::instance().add(context, Timepoint::initial_partitioning,
                           std::chrono::duration<double>(end - start).count());
 
@@ -115,9 +136,19 @@ static inline void partition(Hypergraph& hypergraph,
     io::printLocalSearchBanner(context);
   }
 
+  metrics::reportProgress(hypergraph, context, ProgressPhase::local_search);
+  if (TimeBudget::isActive(context)) {
+    context.partition.time_budget->adaptLocalSearch(context);
+  }
+  TraceSpan uncoarsening_span(context.partition.trace_recorder, "uncoarsening", "local_search");
   start = std::chrono::high_resolution_clock::now();
   coarsener.uncoarsen(refiner);
   end = std::chrono::high_resolution_clock::now();
+  uncoarsening_span.end();
+  if (TimeBudget::isActive(context)) {
+    context.partition.time_budget->recordLocalSearch(
+      std::chrono::duration<double>(end - start).count());
+  }
 
   Timer::instance().add(context, Timepoint::local_search,
                         std::chrono::duration<double>(end - start).count());
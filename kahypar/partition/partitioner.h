@@ -21,7 +21,9 @@
 #pragma once
 
 #include <algorithm>
+#include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "gtest/gtest_prod.h"
@@ -37,8 +39,10 @@
 #include "kahypar/partition/preprocessing/hypergraph_deduplicator.h"
 #include "kahypar/partition/preprocessing/louvain.h"
 #include "kahypar/partition/preprocessing/min_hash_sparsifier.h"
+#include "kahypar/partition/preprocessing/preprocessing_cache.h"
 #include "kahypar/partition/preprocessing/single_node_hyperedge_remover.h"
 #include "kahypar/partition/recursive_bisection.h"
+#include "kahypar/utils/trace.h"
 
 namespace kahypar {
 // Workaround for bug in gtest
@@ -136,6 +140,11 @@ class Partitioner {
   inline void postprocess(Hypergraph& hypergraph, Hypergraph& sparse_hypergraph,
                           const Context& context);
 
+  inline bool readPreprocessingCache(const Hypergraph& hypergraph, Context& context,
+                                     PreprocessingCache& cache, const uint64_t key);
+  inline void writePreprocessingCache(const Hypergraph& hypergraph, const Context& context,
+                                      const uint64_t key);
+
   SingleNodeHyperedgeRemover _single_node_he_remover;
   MinHashSparsifier _pin_sparsifier;
   HypergraphDeduplicator _deduplicator;
@@ -187,6 +196,12 @@ inline void Partitioner::setupContext(const Hypergraph& hypergraph, Context& con
                                                     * hypergraph.totalWeight());
   context.setupPartWeights(hypergraph.totalWeight());
 
+  if (context.initial_partitioning.racing && !context.initial_partitioning.race) {
+    context.initial_partitioning.race = std::make_shared<InitialPartitioningRace>(
+      context.initial_partitioning.racing_margin,
+      context.initial_partitioning.racing_patience);
+  }
+
   ASSERT(context.partition.perfect_balance_part_weights.size() ==
          static_cast<size_t>(context.partition.k));
   ASSERT(context.partition.max_part_weights.size() ==
@@ -229,6 +244,7 @@ inline void Partitioner::preprocess(Hypergraph& hypergraph, Hypergraph& sparse_h
                                     const Context& context) {
   ASSERT(context.preprocessing.enable_min_hash_sparsifier);
 
+  TraceSpan span(context.partition.trace_recorder, "sparsifier", "preprocessing");
   const HighResClockTimepoint start = std::chrono::high_resolution_clock::now();
   sparse_hypergraph = _pin_sparsifier.buildSparsifiedHypergraph(hypergraph, context);
   const HighResClockTimepoint end = std::chrono::high_resolution_clock::now();
@@ -260,6 +276,37 @@ inline void Partitioner::postprocess(Hypergraph& hypergraph, Hypergraph& sparse_
   postprocess(hypergraph);
 }
 
+inline bool Partitioner::readPreprocessingCache(const Hypergraph& hypergraph, Context& context,
+                                                PreprocessingCache& cache, const uint64_t key) {
+  if (context.preprocessing.cache_read_filename.empty() ||
+      !cache.read(context.preprocessing.cache_read_filename, key, hypergraph)) {
+    return false;
+  }
+  if (context.partition.verbose_output) {
+    LOG << "Using preprocessing cache" << context.preprocessing.cache_read_filename;
+  }
+  if (PreprocessingCache::cachesCommunities(context) &&
+      context.evolutionary.communities.empty()) {
+    // preprocess() reuses the community structure stored in the context
+    context.evolutionary.communities = std::move(cache.communities());
+  }
+  return true;
+}
+
+inline void Partitioner::writePreprocessingCache(const Hypergraph& hypergraph,
+                                                 const Context& context,
+                                                 const uint64_t key) {
+  PreprocessingCache cache;
+  for (const auto& memento : _deduplicator.removedIdenticalVertices()) {
+    cache.identicalNodes().emplace_back(memento.u, memento.v);
+  }
+  cache.parallelHyperedges() = _deduplicator.removedParallelHyperedges();
+  if (PreprocessingCache::cachesCommunities(context)) {
+    cache.communities() = hypergraph.communities();
+  }
+  cache.write(context.preprocessing.cache_write_filename, key, hypergraph);
+}
+
 inline void Partitioner::partition(Hypergraph& hypergraph, Context& context) {
   configurePreprocessing(hypergraph, context);
 
@@ -267,11 +314,29 @@ inline void Partitioner::partition(Hypergraph& hypergraph, Context& context) {
   io::printInputInformation(context, hypergraph);
 
   io::printTopLevelPreprocessingBanner(context);
+
+  context.reportProgress(ProgressPhase::preprocessing);
+  TraceSpan preprocessing_span(context.partition.trace_recorder, "preprocessing", "preprocessing");
+  // The preprocessing cache is keyed by the content of the input file.
+  const bool use_cache = !context.partition.graph_filename.empty() &&
+                         (!context.preprocessing.cache_read_filename.empty() ||
+                          !context.preprocessing.cache_write_filename.empty());
+  const uint64_t cache_key = use_cache ? PreprocessingCache::computeKey(context) : 0;
+  PreprocessingCache cache;
+  const bool cache_hit = use_cache && readPreprocessingCache(hypergraph, context, cache, cache_key);
+  const bool write_cache = use_cache && !cache_hit &&
+                           !context.preprocessing.cache_write_filename.empty();
+
   if (context.preprocessing.enable_deduplication) {
     // deduplication needs to be called first, because the code
     // currently assumes that all HEs and HNs in the hypergraph
     // exist (i.e., are enabled).
-    _deduplicator.deduplicate(hypergraph, context);
+    if (cache_hit) {
+      _deduplicator.replay(hypergraph, context, cache.identicalNodes(),
+                           cache.parallelHyperedges());
+    } else {
+      _deduplicator.deduplicate(hypergraph, context);
+    }
   }
 
   sanitize(hypergraph, context);
@@ -283,7 +348,11 @@ inline void Partitioner::partition(Hypergraph& hypergraph, Context& context) {
                   "and while filling the initial population of KaHyParE.");
     Hypergraph sparseHypergraph;
     preprocess(hypergraph, sparseHypergraph, context);
+    if (write_cache) {
+      writePreprocessingCache(hypergraph, context, cache_key);
+    }
     ASSERT(sparseHypergraph.numFixedVertices() == hypergraph.numFixedVertices());
+    preprocessing_span.end();
     partition::partition(sparseHypergraph, context);
     hypergraph.reset();
     postprocess(hypergraph, sparseHypergraph, context);
@@ -295,6 +364,10 @@ inline void Partitioner::partition(Hypergraph& hypergraph, Context& context) {
     context.evolutionary.communities.clear();
   } else {
     preprocess(hypergraph, context);
+    if (write_cache) {
+      writePreprocessingCache(hypergraph, context, cache_key);
+    }
+    preprocessing_span.end();
     partition::partition(hypergraph, context);
     postprocess(hypergraph);
   }
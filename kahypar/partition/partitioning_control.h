@@ -0,0 +1,155 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2019 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <ostream>
+#include <utility>
+
+#include "kahypar/definitions.h"
+
+namespace kahypar {
+enum class ProgressPhase : uint8_t {
+  preprocessing,
+  coarsening,
+  initial_partitioning,
+  local_search,
+  v_cycle,
+  evolutionary,
+  finished
+};
+
+std::ostream& operator<< (std::ostream& os, const ProgressPhase& phase) {
+  switch (phase) {
+    case ProgressPhase::preprocessing: return os << "preprocessing";
+    case ProgressPhase::coarsening: return os << "coarsening";
+    case ProgressPhase::initial_partitioning: return os << "initial_partitioning";
+    case ProgressPhase::local_search: return os << "local_search";
+    case ProgressPhase::v_cycle: return os << "v_cycle";
+    case ProgressPhase::evolutionary: return os << "evolutionary";
+    case ProgressPhase::finished: return os << "finished";
+      // omit default case to trigger compiler warning for missing cases
+  }
+  return os << static_cast<uint8_t>(phase);
+}
+
+/*!
+ * Allows users of the library to observe and to stop a running partitioning call.
+ *
+ * The progress callback is invoked whenever the top-level partitioner enters a new
+ * phase. If a partition already exists, the callback receives its objective and
+ * imbalance. Otherwise both are -1. Invocations are serialized, but they happen in
+ * the thread executing the phase (e.g. in the island threads of the evolutionary
+ * algorithm).
+ *
+ * Cancellation is cooperative: After cancel() was called or the deadline passed,
+ * the partitioner stops at the next safe point. Remaining optional work (further
+ * coarsening, initial partitioning trials, local search, V-cycles and evolutionary
+ * iterations) is skipped, but the current partition is still projected onto the
+ * input hypergraph. The result therefore is the best partition found so far.
+ */
+class PartitioningControl {
+ public:
+  using Callback = std::function<void (const ProgressPhase, const HyperedgeWeight,
+                                       const double)>;
+
+  PartitioningControl() :
+    _cancelled(false),
+    _has_deadline(false),
+    _time_limit(0.0),
+    _deadline(),
+    _callback(),
+    _callback_mutex() { }
+
+  PartitioningControl(const PartitioningControl&) = delete;
+  PartitioningControl& operator= (const PartitioningControl&) = delete;
+
+  PartitioningControl(PartitioningControl&&) = delete;
+  PartitioningControl& operator= (PartitioningControl&&) = delete;
+
+  ~PartitioningControl() = default;
+
+  void setCallback(Callback callback) {
+    std::lock_guard<std::mutex> lock(_callback_mutex);
+    _callback = std::move(callback);
+  }
+
+  // The deadline is set relative to the start of the partitioning call.
+  // A time limit <= 0 disables the deadline.
+  void setTimeLimit(const double seconds) {
+    _time_limit = seconds;
+  }
+
+  // Can be called from any thread (and from within the callback). If no partitioning
+  // call is running, the next call is cancelled.
+  void cancel() {
+    _cancelled.store(true, std::memory_order_relaxed);
+  }
+
+  // Has to be called at the beginning of a partitioning call.
+  void start() {
+    if (_time_limit > 0) {
+      _deadline = std::chrono::high_resolution_clock::now() +
+                  std::chrono::duration_cast<std::chrono::high_resolution_clock::duration>(
+        std::chrono::duration<double>(_time_limit));
+      _has_deadline.store(true, std::memory_order_release);
+    }
+  }
+
+  // Has to be called at the end of a partitioning call.
+  void finish() {
+    _has_deadline.store(false, std::memory_order_relaxed);
+    _cancelled.store(false, std::memory_order_relaxed);
+  }
+
+  bool isCancelled() {
+    if (_cancelled.load(std::memory_order_relaxed)) {
+      return true;
+    }
+    if (_has_deadline.load(std::memory_order_acquire) &&
+        std::chrono::high_resolution_clock::now() >= _deadline) {
+      _cancelled.store(true, std::memory_order_relaxed);
+      return true;
+    }
+    return false;
+  }
+
+  void report(const ProgressPhase phase, const HyperedgeWeight objective,
+              const double imbalance) {
+    std::lock_guard<std::mutex> lock(_callback_mutex);
+    if (_callback) {
+      _callback(phase, objective, imbalance);
+    }
+  }
+
+ private:
+  std::atomic<bool> _cancelled;
+  std::atomic<bool> _has_deadline;
+  double _time_limit;
+  HighResClockTimepoint _deadline;
+  Callback _callback;
+  std::mutex _callback_mutex;
+};
+}  // namespace kahypar
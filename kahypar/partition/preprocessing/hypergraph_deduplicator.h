@@ -66,6 +66,40 @@ class HypergraphDeduplicator {
     }
   }
 
+  // Reapplies the deduplication mappings of a previous call to deduplicate() on the
+  // same input hypergraph without searching for identical vertices and parallel nets.
+  void replay(Hypergraph& hypergraph, const Context& context,
+              const std::vector<std::pair<HypernodeID, HypernodeID> >& identical_nodes,
+              const std::vector<std::pair<HyperedgeID, HyperedgeID> >& parallel_hes) {
+    ASSERT(hypergraph.initialNumNodes() == hypergraph.currentNumNodes() &&
+           hypergraph.initialNumEdges() == hypergraph.currentNumEdges(),
+           "Deduplication assumes unmodified hypergraph!");
+    _removed_identical_nodes.clear();
+    for (const auto& pair : identical_nodes) {
+      _removed_identical_nodes.emplace_back(hypergraph.contract(pair.first, pair.second));
+    }
+    _removed_parallel_hes = parallel_hes;
+    for (const auto& pair : _removed_parallel_hes) {
+      hypergraph.setEdgeWeight(pair.second,
+                               hypergraph.edgeWeight(pair.second) + hypergraph.edgeWeight(pair.first));
+      hypergraph.removeEdge(pair.first);
+    }
+    if (context.partition.verbose_output) {
+      LOG << "Performing deduplication (cached):";
+      LOG << "  # removed parallel hyperedges =" << _removed_parallel_hes.size() << " ";
+      LOG << "  # removed identical vertices  =" << _removed_identical_nodes.size() << " ";
+      io::printStripe();
+    }
+  }
+
+  const std::vector<std::pair<HyperedgeID, HyperedgeID> > & removedParallelHyperedges() const {
+    return _removed_parallel_hes;
+  }
+
+  const std::vector<typename Hypergraph::ContractionMemento> & removedIdenticalVertices() const {
+    return _removed_identical_nodes;
+  }
+
   void restoreRedundancy(Hypergraph& hypergraph) {
     restoreParallelHyperedges(hypergraph);
     restoreIdenticalVertices(hypergraph);
@@ -22,18 +22,26 @@
 #pragma once
 
 #include <algorithm>
+#include <atomic>
 #include <limits>
+#include <memory>
+#include <numeric>
 #include <vector>
 
 #include "kahypar/datastructure/graph.h"
+#include "kahypar/datastructure/sparse_map.h"
 #include "kahypar/definitions.h"
 #include "kahypar/macros.h"
 #include "kahypar/meta/mandatory.h"
 #include "kahypar/partition/context.h"
 #include "kahypar/partition/preprocessing/modularity.h"
+#include "kahypar/partition/time_budget.h"
+#include "kahypar/utils/memory_tracker.h"
+#include "kahypar/utils/parallel.h"
 #include "kahypar/utils/randomize.h"
 #include "kahypar/utils/stats.h"
 #include "kahypar/utils/timer.h"
+#include "kahypar/utils/trace.h"
 
 static constexpr bool debug = false;
 
@@ -42,15 +50,16 @@ template <class QualityMeasure = Mandatory,
           bool RandomizeNodes = true>
 class Louvain {
  private:
-  using Edge = ds::Edge;
-  using Graph = ds::Graph;
+  using Graph = typename QualityMeasure::Graph;
+  using Edge = typename Graph::Edge;
 
  public:
   Louvain(const Hypergraph& hypergraph,
           const Context& context) :
     _graph_hierarchy(),
     _random_node_order(),
-    _context(context) {
+    _context(context),
+    _thread_pool() {
     _graph_hierarchy.emplace_back(hypergraph, context);
   }
 
@@ -59,7 +68,8 @@ class Louvain {
           const Context& context) :
     _graph_hierarchy(),
     _random_node_order(),
-    _context(context) {
+    _context(context),
+    _thread_pool() {
     _graph_hierarchy.emplace_back(adj_array, edges);
   }
 
@@ -100,7 +110,11 @@ class Louvain {
 
       old_quality = cur_quality;
       HighResClockTimepoint start = std::chrono::high_resolution_clock::now();
-      cur_quality = louvain_pass(_graph_hierarchy[cur_idx], quality);
+      if (_context.preprocessing.community_detection.num_threads > 1) {
+        cur_quality = parallel_louvain_pass(_graph_hierarchy[cur_idx], quality);
+      } else {
+        cur_quality = louvain_pass(_graph_hierarchy[cur_idx], quality);
+      }
       HighResClockTimepoint end = std::chrono::high_resolution_clock::now();
       std::chrono::duration<double> elapsed_seconds = end - start;
       DBG << "Louvain-Pass #" << iteration << "Time:" << elapsed_seconds.count() << "s";
@@ -113,7 +127,8 @@ class Louvain {
         cur_quality = quality.quality();
         DBG << "Starting Contraction of communities...";
         start = std::chrono::high_resolution_clock::now();
-        auto contraction = _graph_hierarchy[cur_idx++].contractClusters();
+        auto contraction = _graph_hierarchy[cur_idx++].contractClusters(
+          _context.preprocessing.community_detection.num_threads);
         end = std::chrono::high_resolution_clock::now();
         elapsed_seconds = end - start;
         DBG << "Contraction Time:" << elapsed_seconds.count() << "s";
@@ -123,7 +138,13 @@ class Louvain {
       }
 
       DBG << "";
-    } while (improvement && iteration < max_passes);
+    } while (improvement && iteration < max_passes && !stopEarly());
+
+    size_t hierarchy_bytes = 0;
+    for (const Graph& graph : _graph_hierarchy) {
+      hierarchy_bytes += graph.sizeInBytes();
+    }
+    MemoryTracker::instance().report(MemoryComponent::louvain_graph, hierarchy_bytes);
 
     ASSERT((mapping_stack.size() + 1) == _graph_hierarchy.size());
     while (!mapping_stack.empty()) {
@@ -159,6 +180,18 @@ class Louvain {
   FRIEND_TEST(ALouvainAlgorithm, DoesOneLouvainPass);
   FRIEND_TEST(ALouvainAlgorithm, AssingsMappingToNextLevelFinerGraph);
   FRIEND_TEST(ALouvainKarateClub, DoesLouvainAlgorithm);
+  FRIEND_TEST(AParallelLouvainAlgorithm, DoesOneLouvainPass);
+  FRIEND_TEST(AParallelLouvainAlgorithm, ContractsClustersLikeSequentialContraction);
+
+  static constexpr size_t kNumSubRounds = 16;
+
+  // Community detection stops early if the partitioning call is cancelled or if it
+  // used up its share of the time budget in deadline mode.
+  bool stopEarly() const {
+    return _context.isCancelled() ||
+           (TimeBudget::isActive(_context) &&
+            _context.partition.time_budget->preprocessingTimeExceeded());
+  }
 
   void assignClusterToNextLevelFinerGraph(Graph& fine_graph, const Graph& coarse_graph,
                                           const std::vector<NodeID>& mapping) {
@@ -243,18 +276,162 @@ class Louvain {
 
       DBG << "Iteration #" << iterations << ": Moving" << node_moves << "nodes to new communities.";
     } while (node_moves > 0 &&
-             iterations < _context.preprocessing.community_detection.max_pass_iterations);
+             iterations < _context.preprocessing.community_detection.max_pass_iterations &&
+             !stopEarly());
+
+
+    return quality.quality();
+  }
+
+  /*!
+   * Multi-threaded variant of louvain_pass: Each iteration processes the nodes in
+   * kNumSubRounds sub-rounds. Within a sub-round, the nodes are moved in parallel to
+   * their best community. Community IDs and community volumes are updated atomically,
+   * such that all threads see the moves of the other threads immediately. Since
+   * concurrent moves are based on slightly outdated information, the result depends on
+   * the scheduling of the threads. As in the sequential pass, a node is only evaluated
+   * if one of its incident communities changed since its last evaluation.
+   */
+  EdgeWeight parallel_louvain_pass(Graph& graph, QualityMeasure& quality) {
+    const size_t num_threads = _context.preprocessing.community_detection.num_threads;
+    if (_thread_pool == nullptr) {
+      _thread_pool.reset(new parallel::ThreadPool(num_threads));
+    }
+    const size_t num_nodes = graph.numNodes();
+    size_t node_moves = 0;
+    uint32_t iterations = 0;
+
+    _random_node_order.clear();
+    for (const NodeID& node : graph.nodes()) {
+      _random_node_order.push_back(node);
+    }
+
+    // only false for testing purposes
+    if (RandomizeNodes) {
+      Randomize::instance().shuffleVector(_random_node_order, _random_node_order.size());
+    }
+
+    std::vector<std::atomic<ClusterID> > cluster_id(num_nodes);
+    std::vector<std::atomic<double> > volume(num_nodes);
+    for (const NodeID& node : graph.nodes()) {
+      cluster_id[node].store(graph.clusterID(node), std::memory_order_relaxed);
+      volume[node].store(0.0, std::memory_order_relaxed);
+    }
+    for (const NodeID& node : graph.nodes()) {
+      atomicAdd(volume[graph.clusterID(node)], graph.weightedDegree(node));
+    }
 
+    // Time stamps (see louvain_pass) on the granularity of sub-rounds.
+    std::vector<uint32_t> node_time_stamp(num_nodes, 0);
+    std::vector<std::atomic<uint32_t> > cluster_time_stamp(num_nodes);
+    for (std::atomic<uint32_t>& time_stamp : cluster_time_stamp) {
+      time_stamp.store(1, std::memory_order_relaxed);
+    }
+    uint32_t time_stamp = 0;
+
+    std::vector<ds::SparseMap<ClusterID, EdgeWeight> > incident_cluster_weight;
+    for (size_t i = 0; i < std::min(num_threads, num_nodes); ++i) {
+      incident_cluster_weight.emplace_back(num_nodes);
+    }
+    std::vector<size_t> thread_moves(num_threads, 0);
 
+    const double total_weight = graph.totalWeight();
+    const size_t sub_round_size = (num_nodes + kNumSubRounds - 1) / kNumSubRounds;
+    do {
+      ++iterations;
+      DBG << "######## Starting Parallel Louvain-Pass-Iteration #" << iterations << "########";
+      std::fill(thread_moves.begin(), thread_moves.end(), 0);
+      for (size_t sub_round_begin = 0; sub_round_begin < _random_node_order.size();
+           sub_round_begin += sub_round_size) {
+        const size_t sub_round_end = std::min(sub_round_begin + sub_round_size,
+                                              _random_node_order.size());
+        ++time_stamp;
+        _thread_pool->forEachChunk(sub_round_end - sub_round_begin,
+                                   [&](const size_t thread_id, const size_t begin,
+                                       const size_t end) {
+            ds::SparseMap<ClusterID, EdgeWeight>& weights = incident_cluster_weight[thread_id];
+            for (size_t i = sub_round_begin + begin; i < sub_round_begin + end; ++i) {
+              const NodeID node = _random_node_order[i];
+              const ClusterID from = cluster_id[node].load(std::memory_order_relaxed);
+              weights.clear();
+              bool incident_cluster_changed =
+                node_time_stamp[node] <= cluster_time_stamp[from].load(std::memory_order_relaxed);
+              for (const Edge& e : graph.incidentEdges(node)) {
+                if (e.target_node != node) {
+                  const ClusterID cid = cluster_id[e.target_node].load(std::memory_order_relaxed);
+                  weights[cid] += e.weight;
+                  incident_cluster_changed |= node_time_stamp[node] <=
+                                              cluster_time_stamp[cid].load(
+                                                std::memory_order_relaxed);
+                }
+              }
+              if (!incident_cluster_changed) {
+                continue;
+              }
+              node_time_stamp[node] = time_stamp;
+
+              const double degree = graph.weightedDegree(node);
+              auto gain = [&](const ClusterID cid, const EdgeWeight weight) {
+                            const double cluster_volume =
+                              volume[cid].load(std::memory_order_relaxed) -
+                              (cid == from ? degree : 0.0);
+                            return static_cast<double>(weight) -
+                                   cluster_volume * degree / total_weight;
+                          };
+              ClusterID best_cid = from;
+              double best_gain = gain(from, weights.contains(from) ? weights[from] : 0.0L);
+              for (const auto& cluster : weights) {
+                const double cluster_gain = gain(cluster.key, cluster.value);
+                if (cluster_gain > best_gain) {
+                  best_gain = cluster_gain;
+                  best_cid = cluster.key;
+                }
+              }
+
+              if (best_cid != from) {
+                cluster_id[node].store(best_cid, std::memory_order_relaxed);
+                atomicAdd(volume[from], -degree);
+                atomicAdd(volume[best_cid], degree);
+                cluster_time_stamp[from].store(time_stamp, std::memory_order_relaxed);
+                cluster_time_stamp[best_cid].store(time_stamp, std::memory_order_relaxed);
+                ++thread_moves[thread_id];
+              }
+            }
+          });
+      }
+      node_moves = std::accumulate(thread_moves.begin(), thread_moves.end(),
+                                   static_cast<size_t>(0));
+
+      DBG << "Iteration #" << iterations << ": Moving" << node_moves << "nodes to new communities.";
+    } while (node_moves > 0 &&
+             iterations < _context.preprocessing.community_detection.max_pass_iterations &&
+             !stopEarly());
+
+    for (const NodeID& node : graph.nodes()) {
+      const ClusterID cid = cluster_id[node].load(std::memory_order_relaxed);
+      if (cid != graph.clusterID(node)) {
+        graph.setClusterID(node, cid);
+      }
+    }
+    // The atomic volumes are only used to guide the moves.
+    quality.recompute();
     return quality.quality();
   }
 
+  static void atomicAdd(std::atomic<double>& value, const double delta) {
+    double expected = value.load(std::memory_order_relaxed);
+    while (!value.compare_exchange_weak(expected, expected + delta,
+                                        std::memory_order_relaxed)) { }
+  }
+
   std::vector<Graph> _graph_hierarchy;
   std::vector<NodeID> _random_node_order;
   const Context& _context;
+  std::unique_ptr<parallel::ThreadPool> _thread_pool;
 };
 
 namespace internal {
+template <class QualityMeasure>
 inline std::vector<ClusterID> detectCommunities(const Hypergraph& hypergraph,
                                                 const Context& context) {
   const bool verbose_output = (context.type == ContextType::main &&
@@ -265,10 +442,13 @@ inline std::vector<ClusterID> detectCommunities(const Hypergraph& hypergraph,
     LOG << "Performing community detection:";
   }
 
-  Louvain<Modularity> louvain(hypergraph, context);
+  TraceSpan span(context.partition.trace_recorder, "community_detection", "preprocessing");
+  Louvain<QualityMeasure> louvain(hypergraph, context);
   HighResClockTimepoint start = std::chrono::high_resolution_clock::now();
   const EdgeWeight quality = louvain.run();
   HighResClockTimepoint end = std::chrono::high_resolution_clock::now();
+  span.arg("communities", louvain.numCommunities());
+  span.end();
   std::chrono::duration<double> elapsed_seconds = end - start;
   Timer::instance().add(context, Timepoint::pre_community_detection,
                         std::chrono::duration<double>(end - start).count());
@@ -292,6 +472,18 @@ inline std::vector<ClusterID> detectCommunities(const Hypergraph& hypergraph,
       }));
   return communities;
 }
+
+inline std::vector<ClusterID> detectCommunities(const Hypergraph& hypergraph,
+                                                const Context& context) {
+  switch (context.preprocessing.community_detection.edge_weight_precision) {
+    case LouvainEdgeWeightPrecision::double_precision:
+      return detectCommunities<ModularityT<ds::DoubleWeightGraph> >(hypergraph, context);
+    case LouvainEdgeWeightPrecision::single_precision:
+      return detectCommunities<ModularityT<ds::FloatWeightGraph> >(hypergraph, context);
+    default:
+      return detectCommunities<Modularity>(hypergraph, context);
+  }
+}
 }  // namespace internal
 
 inline void detectCommunities(Hypergraph& hypergraph, const Context& context) {
@@ -32,15 +32,16 @@
 
 namespace kahypar {
 
-class Modularity {
+template <typename GraphType>
+class ModularityT {
  private:
   static constexpr bool enable_heavy_assert = false;
 
-  using Edge = ds::Edge;
-  using Graph = ds::Graph;
-
  public:
-  explicit Modularity(Graph& graph) :
+  using Graph = GraphType;
+  using Edge = typename Graph::Edge;
+
+  explicit ModularityT(Graph& graph) :
     _graph(graph),
     _internal_weight(graph.numNodes(), 0),
     _total_weight(graph.numNodes(), 0),
@@ -106,6 +107,27 @@ class Modularity {
     return gain;
   }
 
+  // Recomputes the internal and total weights of all communities from the current
+  // community assignment of the graph (e.g., after the assignment was changed directly).
+  void recompute() {
+    std::fill(_internal_weight.begin(), _internal_weight.end(), 0);
+    std::fill(_total_weight.begin(), _total_weight.end(), 0);
+    for (const NodeID& node : _graph.nodes()) {
+      const ClusterID cid = _graph.clusterID(node);
+      _total_weight[cid] += _graph.weightedDegree(node);
+      for (const Edge& e : _graph.incidentEdges(node)) {
+        if (_graph.clusterID(e.target_node) == cid) {
+          _internal_weight[cid] += e.weight;
+        }
+      }
+    }
+  }
+
+  size_t sizeInBytes() const {
+    return _internal_weight.capacity() * sizeof(typename Graph::NodeWeight) +
+           _total_weight.capacity() * sizeof(typename Graph::NodeWeight) +
+           _vis.sizeInBytes();
+  }
 
   EdgeWeight quality() {
     EdgeWeight q = 0.0L;
@@ -156,8 +178,11 @@ class Modularity {
   }
 
   Graph& _graph;
-  std::vector<EdgeWeight> _internal_weight;
-  std::vector<EdgeWeight> _total_weight;
+  // community weights are sums of node weights and therefore stored as NodeWeight
+  std::vector<typename Graph::NodeWeight> _internal_weight;
+  std::vector<typename Graph::NodeWeight> _total_weight;
   ds::FastResetFlagArray<> _vis;
 };
+
+using Modularity = ModularityT<ds::Graph>;
 }  // namespace kahypar
@@ -0,0 +1,236 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2019 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "kahypar/definitions.h"
+#include "kahypar/partition/context.h"
+
+namespace kahypar {
+/*!
+ * On-disk cache for the results of the top-level preprocessing, i.e. the
+ * deduplication mappings and the community structure of the input hypergraph.
+ *
+ * The cache is keyed by the content of the input files and by all preprocessing
+ * parameters that influence the result. If a cache file was written for a different
+ * input or configuration, reading it fails and preprocessing is performed as usual.
+ * Note that the seed is not part of the key: Cached communities are reused for all
+ * seeds (as in the evolutionary algorithm).
+ */
+class PreprocessingCache {
+  static constexpr uint64_t kMagic = 0x4b61487950617250;  // "KaHyParP"
+  static constexpr uint64_t kFNVOffsetBasis = 14695981039346656037ull;
+  static constexpr uint64_t kFNVPrime = 1099511628211ull;
+
+ public:
+  using NodePair = std::pair<HypernodeID, HypernodeID>;
+  using EdgePair = std::pair<HyperedgeID, HyperedgeID>;
+
+  PreprocessingCache() :
+    _identical_nodes(),
+    _parallel_hyperedges(),
+    _communities() { }
+
+  PreprocessingCache(const PreprocessingCache&) = delete;
+  PreprocessingCache& operator= (const PreprocessingCache&) = delete;
+
+  PreprocessingCache(PreprocessingCache&&) = default;
+  PreprocessingCache& operator= (PreprocessingCache&&) = default;
+
+  ~PreprocessingCache() = default;
+
+  // Community detection is only cached if it is performed on the input hypergraph itself.
+  static bool cachesCommunities(const Context& context) {
+    return context.preprocessing.enable_community_detection &&
+           context.partition.mode != Mode::recursive_bisection &&
+           !context.preprocessing.min_hash_sparsifier.is_active;
+  }
+
+  // Has to be called after Partitioner::configurePreprocessing, because the
+  // actual louvain edge weight is chosen there.
+  static uint64_t computeKey(const Context& context) {
+    uint64_t key = kFNVOffsetBasis;
+    hashFile(key, context.partition.graph_filename);
+    hashFile(key, context.partition.fixed_vertex_filename);
+    hashValue(key, context.preprocessing.enable_deduplication);
+    hashValue(key, cachesCommunities(context));
+    if (cachesCommunities(context)) {
+      const CommunityDetection& params = context.preprocessing.community_detection;
+      hashValue(key, static_cast<uint8_t>(params.edge_weight));
+      hashValue(key, static_cast<uint8_t>(params.edge_weight_precision));
+      hashValue(key, params.max_pass_iterations);
+      // long double may contain uninitialized padding bytes
+      hashValue(key, static_cast<double>(params.min_eps_improvement));
+      hashValue(key, params.num_threads);
+    }
+    return key;
+  }
+
+  bool read(const std::string& filename, const uint64_t key, const Hypergraph& hypergraph) {
+    std::ifstream file(filename, std::ios::binary);
+    if (!file) {
+      return false;
+    }
+    uint64_t magic = 0;
+    uint64_t file_key = 0;
+    HypernodeID num_nodes = 0;
+    HyperedgeID num_edges = 0;
+    readValue(file, magic);
+    readValue(file, file_key);
+    readValue(file, num_nodes);
+    readValue(file, num_edges);
+    if (!file || magic != kMagic || file_key != key ||
+        num_nodes != hypergraph.initialNumNodes() ||
+        num_edges != hypergraph.initialNumEdges()) {
+      return false;
+    }
+    readVector(file, _identical_nodes);
+    readVector(file, _parallel_hyperedges);
+    readVector(file, _communities);
+    if (!file || !isValid(hypergraph)) {
+      clear();
+      return false;
+    }
+    return true;
+  }
+
+  void write(const std::string& filename, const uint64_t key, const Hypergraph& hypergraph) const {
+    std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+    const uint64_t magic = kMagic;
+    writeValue(file, magic);
+    writeValue(file, key);
+    writeValue(file, hypergraph.initialNumNodes());
+    writeValue(file, hypergraph.initialNumEdges());
+    writeVector(file, _identical_nodes);
+    writeVector(file, _parallel_hyperedges);
+    writeVector(file, _communities);
+    if (!file) {
+      LOG << "Error: Could not write preprocessing cache" << filename;
+    }
+  }
+
+  void clear() {
+    _identical_nodes.clear();
+    _parallel_hyperedges.clear();
+    _communities.clear();
+  }
+
+  // (representative, removed hypernode) pairs in the order of their contraction
+  std::vector<NodePair> & identicalNodes() {
+    return _identical_nodes;
+  }
+
+  // (removed hyperedge, representative) pairs in the order of their removal
+  std::vector<EdgePair> & parallelHyperedges() {
+    return _parallel_hyperedges;
+  }
+
+  // Empty, if the community structure is not cached.
+  std::vector<PartitionID> & communities() {
+    return _communities;
+  }
+
+ private:
+  bool isValid(const Hypergraph& hypergraph) const {
+    for (const NodePair& pair : _identical_nodes) {
+      if (pair.first >= hypergraph.initialNumNodes() ||
+          pair.second >= hypergraph.initialNumNodes()) {
+        return false;
+      }
+    }
+    for (const EdgePair& pair : _parallel_hyperedges) {
+      if (pair.first >= hypergraph.initialNumEdges() ||
+          pair.second >= hypergraph.initialNumEdges()) {
+        return false;
+      }
+    }
+    return _communities.empty() || _communities.size() == hypergraph.initialNumNodes();
+  }
+
+  static void hashBytes(uint64_t& key, const char* bytes, const size_t size) {
+    for (size_t i = 0; i < size; ++i) {
+      key ^= static_cast<uint8_t>(bytes[i]);
+      key *= kFNVPrime;
+    }
+  }
+
+  template <typename T>
+  static void hashValue(uint64_t& key, const T& value) {
+    hashBytes(key, reinterpret_cast<const char*>(&value), sizeof(T));
+  }
+
+  static void hashFile(uint64_t& key, const std::string& filename) {
+    if (filename.empty()) {
+      hashValue(key, static_cast<uint64_t>(0));
+      return;
+    }
+    std::ifstream file(filename, std::ios::binary);
+    std::vector<char> buffer(1 << 16);
+    uint64_t size = 0;
+    while (file) {
+      file.read(buffer.data(), buffer.size());
+      hashBytes(key, buffer.data(), file.gcount());
+      size += file.gcount();
+    }
+    hashValue(key, size);
+  }
+
+  template <typename T>
+  static void readValue(std::ifstream& file, T& value) {
+    file.read(reinterpret_cast<char*>(&value), sizeof(T));
+  }
+
+  template <typename T>
+  static void writeValue(std::ofstream& file, const T& value) {
+    file.write(reinterpret_cast<const char*>(&value), sizeof(T));
+  }
+
+  template <typename T>
+  static void readVector(std::ifstream& file, std::vector<T>& vector) {
+    uint64_t size = 0;
+    readValue(file, size);
+    vector.clear();
+    for (uint64_t i = 0; i < size && file; ++i) {
+      T value;
+      readValue(file, value);
+      vector.push_back(value);
+    }
+  }
+
+  template <typename T>
+  static void writeVector(std::ofstream& file, const std::vector<T>& vector) {
+    writeValue(file, static_cast<uint64_t>(vector.size()));
+    for (const T& value : vector) {
+      writeValue(file, value);
+    }
+  }
+
+  std::vector<NodePair> _identical_nodes;
+  std::vector<EdgePair> _parallel_hyperedges;
+  std::vector<PartitionID> _communities;
+};
+}  // namespace kahypar
@@ -21,6 +21,7 @@
 #pragma once
 
 #include <algorithm>
+#include <cmath>
 #include <vector>
 
 #include "kahypar/definitions.h"
@@ -32,6 +33,8 @@
 #include "kahypar/partition/multilevel.h"
 #include "kahypar/partition/preprocessing/louvain.h"
 #include "kahypar/partition/refinement/i_refiner.h"
+#include "kahypar/partition/time_budget.h"
+#include "kahypar/utils/trace.h"
 
 namespace kahypar {
 namespace recursive_bisection {
@@ -183,6 +186,9 @@ static inline void partition(Hypergraph& input_hypergraph,
                                 (original_context.partition.k - 1));
 
   int bisection_counter = 0;
+  // Each level of the bisection tree approximately processes all pins once.
+  double remaining_work = input_hypergraph_without_fixed_vertices->currentNumPins() *
+                          std::max(std::ceil(std::log2(original_context.partition.k)), 1.0);
 
   if ((original_context.type == ContextType::main && original_context.partition.verbose_output) ||
       (original_context.type == ContextType::initial_partitioning &&
@@ -222,6 +228,9 @@ static inline void partition(Hypergraph& input_hypergraph,
         }
         break;
       case RBHypergraphState::unpartitioned: {
+          TraceSpan span(original_context.partition.trace_recorder, "bisection",
+                         "recursive_bisection");
+          span.arg("lower_k", k1).arg("upper_k", k2);
           Context current_context =
             createCurrentBisectionContext(original_context,
                                           *input_hypergraph_without_fixed_vertices,
@@ -230,6 +239,15 @@ static inline void partition(Hypergraph& input_hypergraph,
           current_context.partition.rb_upper_k = k2;
           ++bisection_counter;
 
+          if (TimeBudget::isActive(current_context)) {
+            // In deadline mode, each bisection gets a share of the remaining time
+            // that is proportional to the size of the hypergraph it bisects.
+            const double work = current_hypergraph.currentNumPins();
+            current_context.partition.time_budget->startCycle(
+              remaining_work > work ? work / remaining_work : 1.0);
+            remaining_work -= work;
+          }
+
           const bool direct_kway_verbose =
             current_context.type == ContextType::initial_partitioning &&
             current_context.initial_partitioning.verbose_output;
@@ -25,6 +25,8 @@
 #include <vector>
 
 #include "kahypar/meta/mandatory.h"
+#include "kahypar/utils/counters.h"
+#include "kahypar/utils/memory_tracker.h"
 
 namespace kahypar {
 template <typename T = Mandatory>
@@ -63,7 +65,9 @@ class TwoWayFMGainCache {
   TwoWayFMGainCache(TwoWayFMGainCache&&) = default;
   TwoWayFMGainCache& operator= (TwoWayFMGainCache&&) = default;
 
-  ~TwoWayFMGainCache() = default;
+  ~TwoWayFMGainCache() {
+    MemoryTracker::instance().report(MemoryComponent::gain_cache, sizeInBytes());
+  }
 
   KAHYPAR_ATTRIBUTE_ALWAYS_INLINE T delta(const size_t index) const {
     ASSERT(index < _size);
@@ -79,6 +83,10 @@ class TwoWayFMGainCache {
     return _size;
   }
 
+  size_t sizeInBytes() const {
+    return _size * sizeof(CacheElement) + _used_delta_entries.capacity() * sizeof(size_t);
+  }
+
   KAHYPAR_ATTRIBUTE_ALWAYS_INLINE void setDelta(const size_t index, const T value) {
     ASSERT(index < _size);
     if (_cache[index].delta == 0) {
@@ -116,6 +124,7 @@ class TwoWayFMGainCache {
 
   KAHYPAR_ATTRIBUTE_ALWAYS_INLINE void updateCacheAndDelta(const size_t index, const T delta) {
     ASSERT(index < _size);
+    KAHYPAR_COUNT(delta_gain_updates, 1);
     if (_cache[index].delta == 0) {
       _used_delta_entries.push_back(index);
     }
@@ -43,6 +43,7 @@
 #include "kahypar/partition/refinement/i_refiner.h"
 #include "kahypar/partition/refinement/move.h"
 #include "kahypar/partition/refinement/policies/fm_improvement_policy.h"
+#include "kahypar/utils/counters.h"
 #include "kahypar/utils/float_compare.h"
 #include "kahypar/utils/randomize.h"
 
@@ -265,6 +266,7 @@ class TwoWayFMRefiner final : public IRefiner,
       DBG << V(current_cut) << V(max_gain_node) << V(max_gain) << V(from_part) << V(to_part)
           << V(_hg.nodeWeight(max_gain_node));
 
+      KAHYPAR_COUNT(fm_moves, 1);
       _hg.changeNodePart(max_gain_node, from_part, to_part, _non_border_hns_to_remove);
 
       Base::updatePQpartState(from_part,
@@ -642,6 +644,7 @@ class TwoWayFMRefiner final : public IRefiner,
   void rollback(int last_index, const int min_cut_index) {
     DBG << "min_cut_index=" << min_cut_index;
     DBG << "last_index=" << last_index;
+    KAHYPAR_COUNT(fm_rollback_moves, last_index - min_cut_index);
     while (last_index != min_cut_index) {
       HypernodeID hn = _performed_moves[last_index];
       _hg.changeNodePart(hn, _hg.partID(hn), (_hg.partID(hn) ^ 1));
@@ -245,7 +245,7 @@ class TwoWayFlowRefiner final : public IRefiner,
           !improvement && cut_flow_network_before == cut_flow_network_after) {
         break;
       }
-    } while (alpha > 1.0);
+    } while (alpha > 1.0 && !_context.isCancelled());
 
     printMetric(true, true);
 
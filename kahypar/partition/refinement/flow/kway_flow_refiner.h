@@ -39,6 +39,7 @@
 #include "kahypar/partition/refinement/flow/flow_refiner_base.h"
 #include "kahypar/partition/refinement/flow/quotient_graph_block_scheduler.h"
 #include "kahypar/partition/refinement/i_refiner.h"
+#include "kahypar/utils/trace.h"
 
 namespace kahypar {
 using ds::SparseSet;
@@ -105,7 +106,7 @@ class KWayFlowRefiner final : public IRefiner,
     bool active_block_exist = true;
     std::vector<bool> active_blocks(_context.partition.k, true);
     size_t current_round = 1;
-    while (active_block_exist) {
+    while (active_block_exist && !_context.isCancelled()) {
       scheduler.randomShuffleQoutientEdges();
       std::vector<bool> tmp_active_blocks(_context.partition.k, false);
       active_block_exist = false;
@@ -121,13 +122,21 @@ class KWayFlowRefiner final : public IRefiner,
           continue;
         }
 
+        if (_context.isCancelled()) {
+          break;
+        }
+
         if (active_blocks[block_0] || active_blocks[block_1]) {
+          TraceSpan span(_context.partition.trace_recorder, "flow_block_pair", "flow");
+          span.arg("block_0", block_0).arg("block_1", block_1).arg("round", current_round);
           _twoway_flow_refiner.updateConfiguration(block_0, block_1,
                                                    &scheduler, true);
           const bool improved = _twoway_flow_refiner.refine(refinement_nodes,
                                                             max_allowed_part_weights,
                                                             changes,
                                                             best_metrics);
+          span.arg("improved", improved);
+          span.end();
           if (improved) {
             DBG << "Improvement found beetween blocks " << block_0 << " and "
                 << block_1 << " in round #"
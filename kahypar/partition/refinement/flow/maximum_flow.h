@@ -38,6 +38,7 @@
 #include "kahypar/meta/typelist.h"
 #include "kahypar/partition/context.h"
 #include "kahypar/partition/metrics.h"
+#include "kahypar/utils/counters.h"
 #include "kahypar/partition/refinement/flow/most_balanced_minimum_cut.h"
 #include "kahypar/utils/randomize.h"
 
@@ -241,7 +242,11 @@ class BoykovKolmogorov : public MaximumFlow<Network>{
   Flow maximumFlow() {
     mapToExternalFlowNetwork();
 
+#ifdef KAHYPAR_ENABLE_COUNTERS
+    const long augmentations_before = _flow_graph.get_augmentation_num();
+#endif
     const Flow max_flow = _flow_graph.maxflow();
+    KAHYPAR_COUNT(flow_augmentations, _flow_graph.get_augmentation_num() - augmentations_before);
 
     FlowGraph::arc* a = _flow_graph.get_first_arc();
     while (a != _flow_graph.arc_last) {
@@ -329,7 +334,11 @@ class IBFS : public MaximumFlow<Network>{
   Flow maximumFlow() {
     mapToExternalFlowNetwork();
 
+#ifdef KAHYPAR_ENABLE_COUNTERS
+    const double augmentations_before = _flow_graph.getStats().getAugs();
+#endif
     _flow_graph.computeMaxFlow();
+    KAHYPAR_COUNT(flow_augmentations, _flow_graph.getStats().getAugs() - augmentations_before);
     const Flow max_flow = _flow_graph.getFlow();
 
     FlowGraph::Arc* a = _flow_graph.arcs;
@@ -29,6 +29,7 @@
 #include "kahypar/partition/context.h"
 #include "kahypar/partition/refinement/move.h"
 #include "kahypar/partition/refinement/uncontraction_gain_changes.h"
+#include "kahypar/utils/counters.h"
 
 namespace kahypar {
 struct RollbackInfo {
@@ -120,6 +121,7 @@ class FMRefinerBase {
     ASSERT(_hg.isBorderNode(hn), "Hypernode" << hn << "is not a border node!");
     DBG << "moving HN" << hn << "from" << from_part
         << "to" << to_part << "(weight=" << _hg.nodeWeight(hn) << ")";
+    KAHYPAR_COUNT(fm_moves, 1);
     _hg.changeNodePart(hn, from_part, to_part);
   }
 
@@ -207,6 +209,7 @@ class FMRefinerBase {
   void rollback(int last_index, const int min_cut_index) {
     DBG << "min_cut_index=" << min_cut_index;
     DBG << "last_index=" << last_index;
+    KAHYPAR_COUNT(fm_rollback_moves, last_index - min_cut_index);
     while (last_index != min_cut_index) {
       const HypernodeID hn = _performed_moves[last_index].hn;
       const PartitionID from_part = _performed_moves[last_index].to_part;
@@ -27,6 +27,8 @@
 #include "kahypar/definitions.h"
 #include "kahypar/meta/mandatory.h"
 #include "kahypar/partition/refinement/gain_cache_element.h"
+#include "kahypar/utils/counters.h"
+#include "kahypar/utils/memory_tracker.h"
 
 namespace kahypar {
 template <typename Gain = Mandatory>
@@ -51,6 +53,7 @@ class KwayGainCache {
     _deltas() { }
 
   ~KwayGainCache() {
+    MemoryTracker::instance().report(MemoryComponent::gain_cache, sizeInBytes());
     for (size_t i = 0; i < _num_hns; ++i) {
       delete[] (reinterpret_cast<Byte*>(_cache[i]));
     }
@@ -168,6 +171,7 @@ class KwayGainCache {
     ASSERT(entryExists(hn, part), V(hn) << V(part));
     ASSERT(cacheElement(hn)->gain(part) != kNotCached, V(hn) << V(part));
     DBGC(hn == hn_to_debug) << "updateEntryAndDelta(" << hn << "," << part << "," << delta << ")";
+    KAHYPAR_COUNT(delta_gain_updates, 1);
     cacheElement(hn)->update(part, delta);
     _deltas.emplace_back(hn, part, -delta, RollbackAction::do_nothing);
   }
@@ -202,6 +206,17 @@ class KwayGainCache {
     _deltas.clear();
   }
 
+  size_t sizeInBytes() const {
+    size_t bytes = _num_hns * sizeof(KFMCacheElement*) +
+                   _deltas.capacity() * sizeof(RollbackElement);
+    for (HypernodeID hn = 0; hn < _num_hns; ++hn) {
+      if (_cache[hn] != nullptr) {
+        bytes += _cache_element_size;
+      }
+    }
+    return bytes;
+  }
+
   const KFMCacheElement & adjacentParts(const HypernodeID hn) const {
     return *cacheElement(hn);
   }
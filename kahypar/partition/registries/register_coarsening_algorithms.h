@@ -28,6 +28,7 @@
 #include "kahypar/partition/coarsening/policies/rating_acceptance_policy.h"
 #include "kahypar/partition/coarsening/policies/rating_community_policy.h"
 #include "kahypar/partition/coarsening/policies/rating_heavy_node_penalty_policy.h"
+#include "kahypar/partition/coarsening/policies/rating_queue_policy.h"
 #include "kahypar/partition/coarsening/policies/rating_score_policy.h"
 #include "kahypar/partition/coarsening/policies/rating_tie_breaking_policy.h"
 #include "kahypar/partition/context.h"
@@ -68,7 +69,9 @@ REGISTER_DISPATCHED_COARSENER(CoarseningAlgorithm::heavy_lazy,
                               meta::PolicyRegistry<AcceptancePolicy>::getInstance().getPolicy(
                                 context.coarsening.rating.acceptance_policy),
                               meta::PolicyRegistry<FixVertexContractionAcceptancePolicy>::getInstance().getPolicy(
-                                context.coarsening.rating.fixed_vertex_acceptance_policy));
+                                context.coarsening.rating.fixed_vertex_acceptance_policy),
+                              meta::PolicyRegistry<RatingQueue>::getInstance().getPolicy(
+                                context.coarsening.rating.queue));
 
 REGISTER_DISPATCHED_COARSENER(CoarseningAlgorithm::heavy_full,
                               FullCoarseningDispatcher,
@@ -83,7 +86,9 @@ REGISTER_DISPATCHED_COARSENER(CoarseningAlgorithm::heavy_full,
                               meta::PolicyRegistry<AcceptancePolicy>::getInstance().getPolicy(
                                 context.coarsening.rating.acceptance_policy),
                               meta::PolicyRegistry<FixVertexContractionAcceptancePolicy>::getInstance().getPolicy(
-                                context.coarsening.rating.fixed_vertex_acceptance_policy));
+                                context.coarsening.rating.fixed_vertex_acceptance_policy),
+                              meta::PolicyRegistry<RatingQueue>::getInstance().getPolicy(
+                                context.coarsening.rating.queue));
 
 REGISTER_DISPATCHED_COARSENER(CoarseningAlgorithm::ml_style,
                               MLCoarseningDispatcher,
@@ -21,6 +21,7 @@
 #pragma once
 
 #include "kahypar/meta/policy_registry.h"
+#include "kahypar/meta/registrar.h"
 #include "kahypar/partition/context.h"
 #include "kahypar/partition/initial_partitioning/initial_partitioning.h"
 
@@ -31,68 +32,99 @@
     return new ip(hypergraph, context);                                    \
   })
 
+// Greedy hypergraph growing partitioners use the integer bucket queue only if the
+// range of gain values is small enough for the given hypergraph.
+#define REGISTER_GHG_INITIAL_PARTITIONER(id, ip)                               \
+  static meta::Registrar<InitialPartitioningFactory> register_ ## ip(          \
+    id,                                                                        \
+    [](Hypergraph& hypergraph, Context& context) -> IInitialPartitioner* {     \
+    if (context.initial_partitioning.gain_queue == GainQueue::integer_bucket && \
+        ip<IntegerBucketGainQueue>::isGainQueueApplicable(hypergraph)) {       \
+      return new ip<IntegerBucketGainQueue>(hypergraph, context);              \
+    }                                                                          \
+    return new ip<BinaryHeapGainQueue>(hypergraph, context);                   \
+  })
+
 namespace kahypar {
 using BFSInitialPartitionerBFS = BFSInitialPartitioner<BFSStartNodeSelectionPolicy<> >;
 using LPInitialPartitionerBFS_FM =
   LabelPropagationInitialPartitioner<BFSStartNodeSelectionPolicy<>,
                                      FMGainComputationPolicy>;
+template <class GainQueuePolicy>
 using GHGInitialPartitionerBFS_FM_SEQ =
   GreedyHypergraphGrowingInitialPartitioner<BFSStartNodeSelectionPolicy<>,
                                             FMGainComputationPolicy,
-                                            SequentialQueueSelectionPolicy>;
+                                            SequentialQueueSelectionPolicy,
+                                            GainQueuePolicy>;
+template <class GainQueuePolicy>
 using GHGInitialPartitionerBFS_FM_GLO =
   GreedyHypergraphGrowingInitialPartitioner<BFSStartNodeSelectionPolicy<>,
                                             FMGainComputationPolicy,
-                                            GlobalQueueSelectionPolicy>;
+                                            GlobalQueueSelectionPolicy,
+                                            GainQueuePolicy>;
+template <class GainQueuePolicy>
 using GHGInitialPartitionerBFS_FM_RND =
   GreedyHypergraphGrowingInitialPartitioner<BFSStartNodeSelectionPolicy<>,
                                             FMGainComputationPolicy,
-                                            RoundRobinQueueSelectionPolicy>;
+                                            RoundRobinQueueSelectionPolicy,
+                                            GainQueuePolicy>;
+template <class GainQueuePolicy>
 using GHGInitialPartitionerBFS_MAXP_SEQ =
   GreedyHypergraphGrowingInitialPartitioner<BFSStartNodeSelectionPolicy<>,
                                             MaxPinGainComputationPolicy,
-                                            SequentialQueueSelectionPolicy>;
+                                            SequentialQueueSelectionPolicy,
+                                            GainQueuePolicy>;
+template <class GainQueuePolicy>
 using GHGInitialPartitionerBFS_MAXP_GLO =
   GreedyHypergraphGrowingInitialPartitioner<BFSStartNodeSelectionPolicy<>,
                                             MaxPinGainComputationPolicy,
-                                            GlobalQueueSelectionPolicy>;
+                                            GlobalQueueSelectionPolicy,
+                                            GainQueuePolicy>;
+template <class GainQueuePolicy>
 using GHGInitialPartitionerBFS_MAXP_RND =
   GreedyHypergraphGrowingInitialPartitioner<BFSStartNodeSelectionPolicy<>,
                                             MaxPinGainComputationPolicy,
-                                            RoundRobinQueueSelectionPolicy>;
+                                            RoundRobinQueueSelectionPolicy,
+                                            GainQueuePolicy>;
+template <class GainQueuePolicy>
 using GHGInitialPartitionerBFS_MAXN_SEQ =
   GreedyHypergraphGrowingInitialPartitioner<BFSStartNodeSelectionPolicy<>,
                                             MaxNetGainComputationPolicy,
-                                            SequentialQueueSelectionPolicy>;
+                                            SequentialQueueSelectionPolicy,
+                                            GainQueuePolicy>;
+template <class GainQueuePolicy>
 using GHGInitialPartitionerBFS_MAXN_GLO =
   GreedyHypergraphGrowingInitialPartitioner<BFSStartNodeSelectionPolicy<>,
                                             MaxNetGainComputationPolicy,
-                                            GlobalQueueSelectionPolicy>;
+                                            GlobalQueueSelectionPolicy,
+                                            GainQueuePolicy>;
+template <class GainQueuePolicy>
 using GHGInitialPartitionerBFS_MAXN_RND =
   GreedyHypergraphGrowingInitialPartitioner<BFSStartNodeSelectionPolicy<>,
                                             MaxNetGainComputationPolicy,
-                                            RoundRobinQueueSelectionPolicy>;
+                                            RoundRobinQueueSelectionPolicy,
+                                            GainQueuePolicy>;
 REGISTER_INITIAL_PARTITIONER(InitialPartitionerAlgorithm::random,
                              RandomInitialPartitioner);
 REGISTER_INITIAL_PARTITIONER(InitialPartitionerAlgorithm::bfs, BFSInitialPartitionerBFS);
 REGISTER_INITIAL_PARTITIONER(InitialPartitionerAlgorithm::lp, LPInitialPartitionerBFS_FM);
-REGISTER_INITIAL_PARTITIONER(InitialPartitionerAlgorithm::greedy_sequential,
-                             GHGInitialPartitionerBFS_FM_SEQ);
-REGISTER_INITIAL_PARTITIONER(InitialPartitionerAlgorithm::greedy_global,
-                             GHGInitialPartitionerBFS_FM_GLO);
-REGISTER_INITIAL_PARTITIONER(InitialPartitionerAlgorithm::greedy_round,
-                             GHGInitialPartitionerBFS_FM_RND);
-REGISTER_INITIAL_PARTITIONER(InitialPartitionerAlgorithm::greedy_sequential_maxpin,
-                             GHGInitialPartitionerBFS_MAXP_SEQ);
-REGISTER_INITIAL_PARTITIONER(InitialPartitionerAlgorithm::greedy_global_maxpin,
-                             GHGInitialPartitionerBFS_MAXP_GLO);
-REGISTER_INITIAL_PARTITIONER(InitialPartitionerAlgorithm::greedy_round_maxpin,
-                             GHGInitialPartitionerBFS_MAXP_RND);
-REGISTER_INITIAL_PARTITIONER(InitialPartitionerAlgorithm::greedy_sequential_maxnet,
-                             GHGInitialPartitionerBFS_MAXN_SEQ);
-REGISTER_INITIAL_PARTITIONER(InitialPartitionerAlgorithm::greedy_global_maxnet,
-                             GHGInitialPartitionerBFS_MAXN_GLO);
-REGISTER_INITIAL_PARTITIONER(InitialPartitionerAlgorithm::greedy_round_maxnet,
-                             GHGInitialPartitionerBFS_MAXN_RND);
+REGISTER_GHG_INITIAL_PARTITIONER(InitialPartitionerAlgorithm::greedy_sequential,
+                                 GHGInitialPartitionerBFS_FM_SEQ);
+REGISTER_GHG_INITIAL_PARTITIONER(InitialPartitionerAlgorithm::greedy_global,
+                                 GHGInitialPartitionerBFS_FM_GLO);
+REGISTER_GHG_INITIAL_PARTITIONER(InitialPartitionerAlgorithm::greedy_round,
+                                 GHGInitialPartitionerBFS_FM_RND);
+REGISTER_GHG_INITIAL_PARTITIONER(InitialPartitionerAlgorithm::greedy_sequential_maxpin,
+                                 GHGInitialPartitionerBFS_MAXP_SEQ);
+REGISTER_GHG_INITIAL_PARTITIONER(InitialPartitionerAlgorithm::greedy_global_maxpin,
+                                 GHGInitialPartitionerBFS_MAXP_GLO);
+REGISTER_GHG_INITIAL_PARTITIONER(InitialPartitionerAlgorithm::greedy_round_maxpin,
+                                 GHGInitialPartitionerBFS_MAXP_RND);
+REGISTER_GHG_INITIAL_PARTITIONER(InitialPartitionerAlgorithm::greedy_sequential_maxnet,
+                                 GHGInitialPartitionerBFS_MAXN_SEQ);
+REGISTER_GHG_INITIAL_PARTITIONER(InitialPartitionerAlgorithm::greedy_global_maxnet,
+                                 GHGInitialPartitionerBFS_MAXN_GLO);
+REGISTER_GHG_INITIAL_PARTITIONER(InitialPartitionerAlgorithm::greedy_round_maxnet,
+                                 GHGInitialPartitionerBFS_MAXN_RND);
 REGISTER_INITIAL_PARTITIONER(InitialPartitionerAlgorithm::pool, PoolInitialPartitioner);
 }  // namespace kahypar
@@ -27,6 +27,7 @@
 #include "kahypar/partition/coarsening/policies/rating_acceptance_policy.h"
 #include "kahypar/partition/coarsening/policies/rating_community_policy.h"
 #include "kahypar/partition/coarsening/policies/rating_heavy_node_penalty_policy.h"
+#include "kahypar/partition/coarsening/policies/rating_queue_policy.h"
 #include "kahypar/partition/coarsening/policies/rating_score_policy.h"
 #include "kahypar/partition/coarsening/policies/rating_tie_breaking_policy.h"
 #include "kahypar/partition/refinement/flow/policies/flow_execution_policy.h"
@@ -75,6 +76,11 @@ REGISTER_POLICY(AcceptancePolicy, AcceptancePolicy::best,
 REGISTER_POLICY(AcceptancePolicy, AcceptancePolicy::best_prefer_unmatched,
                 BestPreferringUnmatched);
 
+REGISTER_POLICY(RatingQueue, RatingQueue::binary_heap,
+                BinaryHeapRatingQueue);
+REGISTER_POLICY(RatingQueue, RatingQueue::quantized_bucket,
+                QuantizedBucketRatingQueue);
+
 REGISTER_POLICY(FixVertexContractionAcceptancePolicy,
                 FixVertexContractionAcceptancePolicy::free_vertex_only,
                 AllowFreeOnFixedFreeOnFree);
@@ -0,0 +1,239 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2019 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <limits>
+
+#include "kahypar/definitions.h"
+#include "kahypar/partition/context.h"
+
+namespace kahypar {
+/*!
+ * Deadline mode of direct k-way and recursive bisection partitioning.
+ *
+ * The time budget distributes the time until the deadline among the phases of the
+ * top-level multilevel cycles and scales down their effort if the full configuration
+ * would not finish in time: the community detection, the number of initial
+ * partitioning runs, the FM stopping parameters, the flow alpha and the number of
+ * V-cycles.
+ *
+ * The running times of initial partitioning and local search are estimated based on
+ * the measured running time of the coarsening phase of the current cycle, which
+ * calibrates the model to the machine and the instance, and on the size of the
+ * coarsest hypergraph. In recursive bisection mode, each bisection gets a share of the
+ * remaining time that is proportional to the size of the hypergraph it bisects.
+ *
+ * The budget only guides the effort of the phases. The deadline itself is enforced by
+ * cancelling the partitioning call (see PartitioningControl).
+ */
+class TimeBudget {
+  // Running time of the local search phase relative to the coarsening phase
+  // (rough estimates for the default configurations).
+  static constexpr double kFMCostFactor = 10.0;
+  static constexpr double kFlowCostFactor = 30.0;
+  // Running time of initial partitioning relative to the time it would take to coarsen
+  // the coarsest hypergraph once per bisection level: the part that is independent of
+  // the number of runs (coarsening and local search of multilevel initial partitioning)
+  // and one run of one algorithm of the pool.
+  static constexpr double kInitialPartitioningCostFactor = 4.0;
+  static constexpr double kInitialPartitioningRunCostFactor = 0.06;
+  static constexpr double kMinAdaptiveStoppingAlpha = 0.01;
+  // Community detection stops early once it used this share of the time of a cycle.
+  static constexpr double kPreprocessingShare = 0.2;
+
+ public:
+  TimeBudget(const double seconds, const Context& context) :
+    _start(std::chrono::high_resolution_clock::now()),
+    _seconds(seconds),
+    _cycle_start(0.0),
+    _cycle_end(seconds),
+    _coarsening_time(0.0),
+    _coarsening_pins(0),
+    _local_search_time(0.0),
+    _max_number_of_fruitless_moves(context.local_search.fm.max_number_of_fruitless_moves),
+    _adaptive_stopping_alpha(context.local_search.fm.adaptive_stopping_alpha),
+    _flow_alpha(context.local_search.flow.alpha) { }
+
+  TimeBudget(const TimeBudget&) = delete;
+  TimeBudget& operator= (const TimeBudget&) = delete;
+
+  TimeBudget(TimeBudget&&) = delete;
+  TimeBudget& operator= (TimeBudget&&) = delete;
+
+  ~TimeBudget() = default;
+
+  // Only the top-level partitioner adapts its effort. Initial partitioning
+  // is covered by the budget of the cycle that calls it.
+  static bool isActive(const Context& context) {
+    return context.partition.time_budget != nullptr && context.type == ContextType::main;
+  }
+
+  double elapsedTime() const {
+    return std::chrono::duration<double>(std::chrono::high_resolution_clock::now() -
+                                         _start).count();
+  }
+
+  // Time left for the current multilevel cycle
+  double remainingTime() const {
+    return std::max(_cycle_end - elapsedTime(), 0.0);
+  }
+
+  // The next multilevel cycle may use the given share of the remaining time.
+  void startCycle(const double share) {
+    _cycle_start = elapsedTime();
+    _cycle_end = _cycle_start + std::min(share, 1.0) * std::max(_seconds - _cycle_start, 0.0);
+  }
+
+  bool preprocessingTimeExceeded() const {
+    return elapsedTime() - _cycle_start > kPreprocessingShare * (_cycle_end - _cycle_start);
+  }
+
+  void recordCoarsening(const double seconds, const HypernodeID num_pins) {
+    _coarsening_time = seconds;
+    _coarsening_pins = num_pins;
+  }
+
+  void recordLocalSearch(const double seconds) {
+    _local_search_time = seconds;
+  }
+
+  double estimatedLocalSearchTime(const Context& context) const {
+    double factor = 0.0;
+    if (usesFM(context.local_search.algorithm)) {
+      factor += kFMCostFactor;
+    }
+    if (usesFlows(context.local_search.algorithm)) {
+      factor += kFlowCostFactor;
+    }
+    return factor * _coarsening_time;
+  }
+
+  // Adapts the context of the initial partitioner such that initial partitioning and
+  // the subsequent local search fit into the remaining time of the cycle: First, the
+  // number of runs is reduced. If a single run does not fit either, community detection
+  // is disabled and the FM stopping parameters of initial partitioning are scaled down.
+  void adaptInitialPartitioning(const Hypergraph& coarsest_hypergraph, Context& init_context,
+                                const Context& context) const {
+    const uint32_t nruns = context.initial_partitioning.nruns;
+    if (_coarsening_pins == 0 || _coarsening_time <= 0.0) {
+      return;
+    }
+    const double bisection_levels = std::max(std::ceil(std::log2(context.partition.k)), 1.0);
+    const double coarsening_time = _coarsening_time / _coarsening_pins *
+                                   coarsest_hypergraph.currentNumPins() * bisection_levels;
+    const double fixed_time = kInitialPartitioningCostFactor * coarsening_time;
+    const double time_per_run = kInitialPartitioningRunCostFactor * coarsening_time *
+                                numInitialPartitioningAlgorithms(context) /
+                                std::max(context.initial_partitioning.num_threads,
+                                         static_cast<size_t>(1));
+    const double initial_partitioning_time = fixed_time + nruns * time_per_run;
+    const double local_search_time = estimatedLocalSearchTime(context);
+    const double remaining = remainingTime();
+    if (initial_partitioning_time + local_search_time <= remaining) {
+      return;
+    }
+    const double budget = remaining * initial_partitioning_time /
+                          (initial_partitioning_time + local_search_time);
+    init_context.initial_partitioning.nruns =
+      std::max(std::min(static_cast<uint32_t>(std::max(budget - fixed_time, 0.0) / time_per_run),
+                        nruns), 1u);
+    if (budget < fixed_time + time_per_run) {
+      const double scale = budget / (fixed_time + time_per_run);
+      init_context.preprocessing.enable_community_detection = false;
+      init_context.local_search.fm.max_number_of_fruitless_moves =
+        std::max(static_cast<uint32_t>(
+                   scale * init_context.local_search.fm.max_number_of_fruitless_moves), 1u);
+      init_context.local_search.fm.adaptive_stopping_alpha =
+        scaledAdaptiveStoppingAlpha(init_context.local_search.fm.adaptive_stopping_alpha, scale);
+    }
+  }
+
+  // Scales the stopping parameters of FM and the size of the flow problems
+  // down by the ratio between the remaining and the estimated local search time.
+  void adaptLocalSearch(const Context& context) const {
+    const double estimate = estimatedLocalSearchTime(context);
+    const double scale = estimate > 0.0 ? std::min(remainingTime() / estimate, 1.0) : 1.0;
+    context.local_search.fm.max_number_of_fruitless_moves =
+      std::max(static_cast<uint32_t>(scale * _max_number_of_fruitless_moves), 1u);
+    context.local_search.fm.adaptive_stopping_alpha =
+      scaledAdaptiveStoppingAlpha(_adaptive_stopping_alpha, scale);
+    context.local_search.flow.alpha = std::max(scale * _flow_alpha, 1.0);
+  }
+
+  void restoreLocalSearch(const Context& context) const {
+    context.local_search.fm.max_number_of_fruitless_moves = _max_number_of_fruitless_moves;
+    context.local_search.fm.adaptive_stopping_alpha = _adaptive_stopping_alpha;
+    context.local_search.flow.alpha = _flow_alpha;
+  }
+
+  // A V-cycle is only started if it is expected to finish in time. Its running
+  // time is estimated by the coarsening and local search time of the last cycle.
+  bool allowsVCycle() const {
+    return _coarsening_time + _local_search_time <= remainingTime();
+  }
+
+ private:
+  static double scaledAdaptiveStoppingAlpha(const double alpha, const double scale) {
+    const double min_alpha = kMinAdaptiveStoppingAlpha;
+    return std::max(scale * alpha, min_alpha);
+  }
+
+  static bool usesFM(const RefinementAlgorithm algorithm) {
+    return algorithm != RefinementAlgorithm::twoway_flow &&
+           algorithm != RefinementAlgorithm::kway_flow &&
+           algorithm != RefinementAlgorithm::do_nothing;
+  }
+
+  static bool usesFlows(const RefinementAlgorithm algorithm) {
+    return algorithm == RefinementAlgorithm::twoway_flow ||
+           algorithm == RefinementAlgorithm::twoway_fm_flow ||
+           algorithm == RefinementAlgorithm::kway_flow ||
+           algorithm == RefinementAlgorithm::kway_fm_flow_km1 ||
+           algorithm == RefinementAlgorithm::kway_fm_flow;
+  }
+
+  static uint32_t numInitialPartitioningAlgorithms(const Context& context) {
+    if (context.initial_partitioning.algo != InitialPartitionerAlgorithm::pool) {
+      return 1;
+    }
+    // The first 12 bits of the pool type select the algorithms of the pool.
+    uint32_t num_algorithms = 0;
+    for (uint32_t i = 0; i < 12; ++i) {
+      num_algorithms += (context.initial_partitioning.pool_type >> i) & 1;
+    }
+    return std::max(num_algorithms, 1u);
+  }
+
+  const HighResClockTimepoint _start;
+  const double _seconds;
+  double _cycle_start;
+  double _cycle_end;
+  double _coarsening_time;
+  HypernodeID _coarsening_pins;
+  double _local_search_time;
+  const uint32_t _max_number_of_fruitless_moves;
+  const double _adaptive_stopping_alpha;
+  const double _flow_alpha;
+};
+}  // namespace kahypar
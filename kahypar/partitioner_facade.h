@@ -36,8 +36,10 @@
 #include "kahypar/macros.h"
 #include "kahypar/partition/evo_partitioner.h"
 #include "kahypar/partition/metrics.h"
+#include "kahypar/partition/time_budget.h"
 #include "kahypar/utils/math.h"
 #include "kahypar/utils/randomize.h"
+#include "kahypar/utils/trace.h"
 
 namespace kahypar {
 class PartitionerFacade {
@@ -57,7 +59,39 @@ class PartitionerFacade {
       setupVcycleRefinement(hypergraph, context);
     }
 
+    if (!context.partition.trace_filename.empty()) {
+      context.partition.trace_recorder = std::make_shared<TraceRecorder>();
+    }
+    if (context.partition.deadline > 0) {
+      if (context.partition.control == nullptr) {
+        context.partition.control = std::make_shared<PartitioningControl>();
+      }
+      if (!context.partition_evolutionary) {
+        context.partition.time_budget = std::make_shared<TimeBudget>(context.partition.deadline,
+                                                                     context);
+      }
+    }
+    if (context.partition.control != nullptr) {
+      context.partition.control->setTimeLimit(context.partition.deadline);
+      context.partition.control->start();
+    }
+
     const auto time_and_iteration = performPartitioning(hypergraph, context);
+
+    if (context.partition.trace_recorder != nullptr) {
+      context.partition.trace_recorder->writeChromeTrace(context.partition.trace_filename);
+      context.partition.trace_recorder = nullptr;
+    }
+    if (context.partition.control != nullptr) {
+      context.partition.control->report(ProgressPhase::finished,
+                                        metrics::correctMetric(hypergraph, context),
+                                        metrics::imbalance(hypergraph, context));
+      context.partition.control->finish();
+    }
+    if (context.partition.time_budget != nullptr) {
+      context.partition.time_budget->restoreLocalSearch(context);
+      context.partition.time_budget = nullptr;
+    }
     const std::chrono::duration<double> elapsed_seconds = time_and_iteration.first;
     const size_t iteration = time_and_iteration.second;
 
@@ -126,7 +160,8 @@ class PartitionerFacade {
     double best_imbalance = 1.0;
 
     Partitioner partitioner;
-    while (elapsed_time.count() < context.partition.time_limit) {
+    while (elapsed_time.count() < context.partition.time_limit &&
+           (iteration == 0 || !context.isCancelled())) {
       const HighResClockTimepoint start = std::chrono::high_resolution_clock::now();
       partitioner.partition(hypergraph, context);
       const HighResClockTimepoint end = std::chrono::high_resolution_clock::now();
@@ -164,7 +199,7 @@ class PartitionerFacade {
   void performEvolutionaryPartitioning(Hypergraph& hypergraph, Context& context) {
     EvoPartitioner evo_partitioner(context);
     evo_partitioner.partition(hypergraph, context);
-    const std::vector<PartitionID>& best_partition = evo_partitioner.bestPartition();
+    const std::vector<PartitionID> best_partition = evo_partitioner.bestPartition();
 
     hypergraph.reset();
     for (const auto& hn : hypergraph.nodes()) {
@@ -175,6 +210,7 @@ class PartitionerFacade {
   std::pair<std::chrono::duration<double>, size_t> performPartitioning(Hypergraph& hypergraph,
                                                                        Context& context) {
     size_t iteration = 0;
+    TraceSpan span(context.partition.trace_recorder, "partitioning", "partitioning");
     const HighResClockTimepoint complete_start = std::chrono::high_resolution_clock::now();
     if (context.partition.time_limit != 0 && !context.partition_evolutionary) {
       iteration = performTimeLimitedRepeatedPartitioning(hypergraph, context);
@@ -0,0 +1,187 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2019 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <ostream>
+#include <vector>
+
+namespace kahypar {
+enum class Counter : uint8_t {
+  fm_moves,
+  fm_rollback_moves,
+  delta_gain_updates,
+  pq_operations,
+  rating_calls,
+  pins_visited,
+  parallel_nets_removed,
+  flow_augmentations,
+  COUNT
+};
+
+std::ostream& operator<< (std::ostream& os, const Counter& counter) {
+  switch (counter) {
+    case Counter::fm_moves: return os << "fm_moves";
+    case Counter::fm_rollback_moves: return os << "fm_rollback_moves";
+    case Counter::delta_gain_updates: return os << "delta_gain_updates";
+    case Counter::pq_operations: return os << "pq_operations";
+    case Counter::rating_calls: return os << "rating_calls";
+    case Counter::pins_visited: return os << "pins_visited";
+    case Counter::parallel_nets_removed: return os << "parallel_nets_removed";
+    case Counter::flow_augmentations: return os << "flow_augmentations";
+    case Counter::COUNT: return os << "";
+      // omit default case to trigger compiler warning for missing cases
+  }
+  return os << static_cast<uint8_t>(counter);
+}
+
+/*!
+ * Event counters for the hot paths of the partitioner.
+ *
+ * Each thread accumulates into its own block of counters, which is registered at the
+ * singleton on first use. Since a block is only written by its own thread, increments
+ * are plain relaxed loads and stores. The values of terminated threads are merged into
+ * the singleton. Counting is compiled in only if KAHYPAR_ENABLE_COUNTERS is defined,
+ * otherwise KAHYPAR_COUNT expands to nothing.
+ */
+class Counters {
+ public:
+  static constexpr size_t kNumCounters = static_cast<size_t>(Counter::COUNT);
+  using Values = std::array<uint64_t, kNumCounters>;
+
+#ifdef KAHYPAR_ENABLE_COUNTERS
+  static constexpr bool kEnabled = true;
+#else
+  static constexpr bool kEnabled = false;
+#endif
+
+ private:
+  class Local {
+ public:
+    Local() :
+      values() {
+      for (std::atomic<uint64_t>& value : values) {
+        value.store(0, std::memory_order_relaxed);
+      }
+      Counters::instance().registerLocal(this);
+    }
+
+    ~Local() {
+      Counters::instance().unregisterLocal(this);
+    }
+
+    Local(const Local&) = delete;
+    Local& operator= (const Local&) = delete;
+
+    Local(Local&&) = delete;
+    Local& operator= (Local&&) = delete;
+
+    std::array<std::atomic<uint64_t>, kNumCounters> values;
+  };
+
+ public:
+  Counters(const Counters&) = delete;
+  Counters& operator= (const Counters&) = delete;
+
+  Counters(Counters&&) = delete;
+  Counters& operator= (Counters&&) = delete;
+
+  ~Counters() = default;
+
+  static Counters & instance() {
+    static Counters instance;
+    return instance;
+  }
+
+  static void add(const Counter& counter, const uint64_t n) {
+    thread_local Local local;
+    std::atomic<uint64_t>& value = local.values[static_cast<size_t>(counter)];
+    value.store(value.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+  }
+
+  Values totals() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    Values totals = _retired;
+    for (const Local* local : _locals) {
+      for (size_t i = 0; i < kNumCounters; ++i) {
+        totals[i] += local->values[i].load(std::memory_order_relaxed);
+      }
+    }
+    return totals;
+  }
+
+  uint64_t total(const Counter& counter) {
+    return totals()[static_cast<size_t>(counter)];
+  }
+
+  // Must not be called while other threads are counting.
+  void reset() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _retired.fill(0);
+    for (Local* local : _locals) {
+      for (std::atomic<uint64_t>& value : local->values) {
+        value.store(0, std::memory_order_relaxed);
+      }
+    }
+  }
+
+ private:
+  Counters() :
+    _mutex(),
+    _locals(),
+    _retired() {
+    _retired.fill(0);
+  }
+
+  void registerLocal(Local* local) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _locals.push_back(local);
+  }
+
+  void unregisterLocal(Local* local) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    for (size_t i = 0; i < kNumCounters; ++i) {
+      _retired[i] += local->values[i].load(std::memory_order_relaxed);
+    }
+    for (size_t i = 0; i < _locals.size(); ++i) {
+      if (_locals[i] == local) {
+        _locals[i] = _locals.back();
+        _locals.pop_back();
+        break;
+      }
+    }
+  }
+
+  std::mutex _mutex;
+  std::vector<Local*> _locals;
+  Values _retired;
+};
+}  // namespace kahypar
+
+#ifdef KAHYPAR_ENABLE_COUNTERS
+#define KAHYPAR_COUNT(counter, n) \
+  ::kahypar::Counters::add(::kahypar::Counter::counter, n)
+#else
+#define KAHYPAR_COUNT(counter, n)
+#endif
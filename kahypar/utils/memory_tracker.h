@@ -0,0 +1,130 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2019 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#if !defined(_MSC_VER)
+#include <sys/resource.h>
+#endif
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <mutex>
+#include <ostream>
+
+namespace kahypar {
+enum class MemoryComponent : uint8_t {
+  hypergraph,
+  pins_in_part,
+  coarsening_history,
+  gain_cache,
+  flow_network,
+  louvain_graph,
+  population,
+  COUNT
+};
+
+std::ostream& operator<< (std::ostream& os, const MemoryComponent& component) {
+  switch (component) {
+    case MemoryComponent::hypergraph: return os << "hypergraph";
+    case MemoryComponent::pins_in_part: return os << "pins_in_part";
+    case MemoryComponent::coarsening_history: return os << "coarsening_history";
+    case MemoryComponent::gain_cache: return os << "gain_cache";
+    case MemoryComponent::flow_network: return os << "flow_network";
+    case MemoryComponent::louvain_graph: return os << "louvain_graph";
+    case MemoryComponent::population: return os << "population";
+    case MemoryComponent::COUNT: return os << "";
+      // omit default case to trigger compiler warning for missing cases
+  }
+  return os << static_cast<uint8_t>(component);
+}
+
+/*!
+ * Keeps track of the memory consumption of the major data structures.
+ *
+ * The data structures report their size in bytes when they are at their largest
+ * (usually right before they are released). For each component, only the largest
+ * reported size is kept, i.e. the sizes of data structures that exist concurrently
+ * (e.g. the islands of the evolutionary algorithm) are not summed up. The phase-level
+ * peak resident set size is tracked by the Timer.
+ */
+class MemoryTracker {
+ public:
+  static constexpr size_t kNumComponents = static_cast<size_t>(MemoryComponent::COUNT);
+  using Sizes = std::array<size_t, kNumComponents>;
+
+  MemoryTracker(const MemoryTracker&) = delete;
+  MemoryTracker& operator= (const MemoryTracker&) = delete;
+
+  MemoryTracker(MemoryTracker&&) = delete;
+  MemoryTracker& operator= (MemoryTracker&&) = delete;
+
+  ~MemoryTracker() = default;
+
+  static MemoryTracker & instance() {
+    static MemoryTracker instance;
+    return instance;
+  }
+
+  // Peak resident set size of the process in bytes (0, if not available).
+  static size_t peakRSS() {
+#if defined(_MSC_VER)
+    return 0;
+#else
+    struct rusage usage = { };
+    if (getrusage(RUSAGE_SELF, &usage) != 0) {
+      return 0;
+    }
+#if defined(__APPLE__)
+    return static_cast<size_t>(usage.ru_maxrss);
+#else
+    return static_cast<size_t>(usage.ru_maxrss) * 1024;
+#endif
+#endif
+  }
+
+  void report(const MemoryComponent& component, const size_t bytes) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    size_t& peak = _peak_bytes[static_cast<size_t>(component)];
+    peak = std::max(peak, bytes);
+  }
+
+  Sizes peakSizes() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _peak_bytes;
+  }
+
+  void clear() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _peak_bytes.fill(0);
+  }
+
+ private:
+  MemoryTracker() :
+    _mutex(),
+    _peak_bytes() {
+    _peak_bytes.fill(0);
+  }
+
+  std::mutex _mutex;
+  Sizes _peak_bytes;
+};
+}  // namespace kahypar
@@ -0,0 +1,190 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2019 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace kahypar {
+namespace parallel {
+/*!
+ * Splits the range [0, size) into at most num_threads contiguous chunks of
+ * (almost) equal size and calls f(thread_id, begin, end) for each chunk in its
+ * own thread. The first chunk is processed by the calling thread. The function
+ * returns after all chunks are processed.
+ */
+template <typename F>
+void forEachChunk(const size_t num_threads, const size_t size, const F& f) {
+  const size_t num_chunks = std::max(static_cast<size_t>(1), std::min(num_threads, size));
+  if (num_chunks == 1) {
+    f(0, 0, size);
+    return;
+  }
+
+  const size_t chunk_size = size / num_chunks;
+  const size_t remainder = size % num_chunks;
+  auto chunkBegin = [&](const size_t chunk) {
+                      return chunk * chunk_size + std::min(chunk, remainder);
+                    };
+
+  std::vector<std::thread> threads;
+  threads.reserve(num_chunks - 1);
+  for (size_t chunk = 1; chunk < num_chunks; ++chunk) {
+    const size_t begin = chunkBegin(chunk);
+    const size_t end = chunkBegin(chunk + 1);
+    threads.emplace_back([&f, chunk, begin, end]() {
+        f(chunk, begin, end);
+      });
+  }
+  f(0, 0, chunkBegin(1));
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+}
+
+/*!
+ * A fixed set of threads that repeatedly processes chunks of a range.
+ *
+ * In contrast to forEachChunk, the threads are only created once. This pays off
+ * for algorithms with many short parallel phases (e.g., the sub-rounds of the
+ * parallel louvain pass). The calling thread acts as thread 0.
+ */
+class ThreadPool {
+ public:
+  explicit ThreadPool(const size_t num_threads) :
+    _num_threads(std::max(num_threads, static_cast<size_t>(1))),
+    _mutex(),
+    _work_available(),
+    _work_done(),
+    _task(nullptr),
+    _generation(0),
+    _num_pending(0),
+    _stop(false),
+    _workers() {
+    _workers.reserve(_num_threads - 1);
+    for (size_t thread = 1; thread < _num_threads; ++thread) {
+      _workers.emplace_back([this, thread]() {
+          work(thread);
+        });
+    }
+  }
+
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator= (const ThreadPool&) = delete;
+
+  ThreadPool(ThreadPool&&) = delete;
+  ThreadPool& operator= (ThreadPool&&) = delete;
+
+  ~ThreadPool() {
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      _stop = true;
+    }
+    _work_available.notify_all();
+    for (std::thread& worker : _workers) {
+      worker.join();
+    }
+  }
+
+  size_t numThreads() const {
+    return _num_threads;
+  }
+
+  // Same semantics as parallel::forEachChunk with num_threads = numThreads().
+  template <typename F>
+  void forEachChunk(const size_t size, const F& f) {
+    const size_t num_chunks = std::max(static_cast<size_t>(1), std::min(_num_threads, size));
+    if (num_chunks == 1) {
+      f(0, 0, size);
+      return;
+    }
+    const size_t chunk_size = size / num_chunks;
+    const size_t remainder = size % num_chunks;
+    auto chunkBegin = [&](const size_t chunk) {
+                        return chunk * chunk_size + std::min(chunk, remainder);
+                      };
+    run([&](const size_t chunk) {
+        if (chunk < num_chunks) {
+          f(chunk, chunkBegin(chunk), chunkBegin(chunk + 1));
+        }
+      });
+  }
+
+ private:
+  void run(const std::function<void(size_t)>& task) {
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      _task = &task;
+      _num_pending = _workers.size();
+      ++_generation;
+    }
+    _work_available.notify_all();
+    task(0);
+    std::unique_lock<std::mutex> lock(_mutex);
+    _work_done.wait(lock, [&]() {
+        return _num_pending == 0;
+      });
+    _task = nullptr;
+  }
+
+  void work(const size_t thread) {
+    size_t generation = 0;
+    while (true) {
+      const std::function<void(size_t)>* task = nullptr;
+      {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _work_available.wait(lock, [&]() {
+            return _stop || _generation != generation;
+          });
+        if (_stop) {
+          return;
+        }
+        generation = _generation;
+        task = _task;
+      }
+      (*task)(thread);
+      bool last = false;
+      {
+        std::lock_guard<std::mutex> lock(_mutex);
+        last = --_num_pending == 0;
+      }
+      if (last) {
+        _work_done.notify_one();
+      }
+    }
+  }
+
+  const size_t _num_threads;
+  std::mutex _mutex;
+  std::condition_variable _work_available;
+  std::condition_variable _work_done;
+  const std::function<void(size_t)>* _task;
+  size_t _generation;
+  size_t _num_pending;
+  bool _stop;
+  std::vector<std::thread> _workers;
+};
+}  // namespace parallel
+}  // namespace kahypar
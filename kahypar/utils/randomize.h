@@ -24,6 +24,8 @@
 #include <ctime>
 #include <limits>
 #include <random>
+#include <sstream>
+#include <string>
 #include <vector>
 
 namespace kahypar {
@@ -34,8 +36,9 @@ class Randomize {
   Randomize& operator= (const Randomize&) = delete;
   Randomize& operator= (Randomize&&) = delete;
 
+  // Each thread uses its own random number generator.
   static Randomize & instance() {
-    static Randomize instance;
+    static thread_local Randomize instance;
     return instance;
   }
 
@@ -80,6 +83,29 @@ class Randomize {
     return _gen;
   }
 
+  // Textual representation of the state of the random number generator,
+  // e.g. to continue a run from a checkpoint.
+  std::string state() const {
+    std::ostringstream out;
+    out << _seed << ' ' << _gen << ' ' << _norm_dist;
+    return out.str();
+  }
+
+  bool setState(const std::string& state) {
+    std::istringstream in(state);
+    int seed = -1;
+    std::mt19937 gen;
+    std::normal_distribution<float> norm_dist;
+    in >> seed >> gen >> norm_dist;
+    if (!in) {
+      return false;
+    }
+    _seed = seed;
+    _gen = gen;
+    _norm_dist = norm_dist;
+    return true;
+  }
+
  private:
   Randomize() :
     _seed(-1),
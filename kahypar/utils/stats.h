@@ -22,6 +22,7 @@
 #include <algorithm>
 #include <array>
 #include <map>
+#include <mutex>
 #include <sstream>
 #include <string>
 
@@ -59,13 +60,15 @@ class Stats {
     _context(context),
     _oss(),
     _parent(nullptr),
-    _logs() { }
+    _logs(),
+    _mutex() { }
 
   Stats(const Context& context, Stats* parent) :
     _context(context),
     _oss(),
     _parent(parent),
-    _logs() { }
+    _logs(),
+    _mutex() { }
 
   ~Stats() {
     if (_parent != nullptr) {
@@ -84,7 +87,7 @@ class Stats {
   }
 
   void add(const StatTag& tag, const std::string& key, const double& value) {
-    _logs[static_cast<size_t>(tag)][key] = value;
+    _logs[static_cast<size_t>(tag)][key] += value;
   }
 
   Stats & topLevel() {
@@ -100,17 +103,20 @@ class Stats {
   }
 
  private:
-  std::ostringstream & parentOutputStream() {
+  Stats & root() {
     if (_parent) {
-      return _parent->parentOutputStream();
+      return _parent->root();
     }
-    return _oss;
+    return *this;
   }
 
+  // Contexts may be copied and destroyed concurrently (e.g. by parallel initial
+  // partitioning or batch partitioning), so writes to the shared stream are serialized.
   void serializeToParent() {
-    std::ostringstream& oss = parentOutputStream();
+    Stats& root_stats = root();
+    std::lock_guard<std::mutex> lock(root_stats._mutex);
     for (int i = 0; i < static_cast<int>(StatTag::COUNT); ++i) {
-      serialize(_logs[i], static_cast<StatTag>(i), oss);
+      serialize(_logs[i], static_cast<StatTag>(i), root_stats._oss);
     }
   }
 
@@ -128,5 +134,6 @@ class Stats {
   std::ostringstream _oss;
   Stats* _parent;
   std::array<Log, static_cast<int>(StatTag::COUNT)> _logs;
+  std::mutex _mutex;
 };
 }  // namespace kahypar
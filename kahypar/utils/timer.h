@@ -20,11 +20,16 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <chrono>
+#include <mutex>
+#include <ostream>
 #include <string>
 #include <vector>
 
 #include "kahypar/definitions.h"
+#include "kahypar/utils/memory_tracker.h"
 
 namespace kahypar {
 enum class Timepoint : uint8_t {
@@ -43,6 +48,26 @@ enum class Timepoint : uint8_t {
   COUNT
 };
 
+std::ostream& operator<< (std::ostream& os, const Timepoint& timepoint) {
+  switch (timepoint) {
+    case Timepoint::pre_sparsifier: return os << "pre_sparsifier";
+    case Timepoint::pre_community_detection: return os << "pre_community_detection";
+    case Timepoint::coarsening: return os << "coarsening";
+    case Timepoint::initial_partitioning: return os << "initial_partitioning";
+    case Timepoint::ip_coarsening: return os << "ip_coarsening";
+    case Timepoint::ip_initial_partitioning: return os << "ip_initial_partitioning";
+    case Timepoint::ip_local_search: return os << "ip_local_search";
+    case Timepoint::local_search: return os << "local_search";
+    case Timepoint::v_cycle_coarsening: return os << "v_cycle_coarsening";
+    case Timepoint::v_cycle_local_search: return os << "v_cycle_local_search";
+    case Timepoint::post_sparsifier_restore: return os << "post_sparsifier_restore";
+    case Timepoint::evolutionary: return os << "evolutionary";
+    case Timepoint::COUNT: return os << "";
+      // omit default case to trigger compiler warning for missing cases
+  }
+  return os << static_cast<uint8_t>(timepoint);
+}
+
 class Timer {
  private:
   class BisectionTiming {
@@ -68,15 +93,19 @@ class Timer {
     int lk;
     int rk;
     double time;
+    // bytes by which the peak RSS of the process grew since the previous timing
+    size_t peak_rss_increase;
 
-    Timing(const Context& context, const Timepoint& timepoint, const double& time) :
+    Timing(const Context& context, const Timepoint& timepoint, const double& time,
+           const size_t peak_rss_increase) :
       type(context.type),
       mode(context.partition.mode),
       timepoint(timepoint),
       v_cycle(context.partition.current_v_cycle),
       lk(context.partition.rb_lower_k),
       rk(context.partition.rb_upper_k),
-      time(time) { }
+      time(time),
+      peak_rss_increase(peak_rss_increase) { }
   };
 
 
@@ -101,11 +130,22 @@ class Timer {
     std::vector<BisectionTiming> bisection_coarsening = { };
     std::vector<BisectionTiming> bisection_initial_partitioning = { };
     std::vector<BisectionTiming> bisection_local_search = { };
+    // Peak RSS of the process and the bytes by which each phase raised it. Timings of
+    // the initial partitioning context are attributed to the ip_* timepoints.
+    size_t peak_rss = 0;
+    std::array<size_t, static_cast<size_t>(Timepoint::COUNT)> peak_rss_increase = { };
   };
 
  public:
+  // Timings may be added concurrently, e.g. by the islands of the evolutionary algorithm.
   void add(const Context& context, const Timepoint& timepoint, const double& time) {
-    _timings.emplace_back(context, timepoint, time);
+    std::lock_guard<std::mutex> lock(_mutex);
+    const size_t peak_rss = MemoryTracker::peakRSS();
+    _timings.emplace_back(context, timepoint, time, peak_rss - std::min(peak_rss, _peak_rss));
+    _peak_rss = std::max(_peak_rss, peak_rss);
+    if (timepoint == Timepoint::evolutionary) {
+      threadEvolutionaryTime() += time;
+    }
   }
 
   static Timer & instance() {
@@ -114,13 +154,17 @@ class Timer {
   }
 
   void clear() {
+    std::lock_guard<std::mutex> lock(_mutex);
     _timings.clear();
     _evaluated = false;
     _result = Result{ };
+    _peak_rss = MemoryTracker::peakRSS();
+    threadEvolutionaryTime() = 0.0;
   }
 
 
   const Result & result() {
+    std::lock_guard<std::mutex> lock(_mutex);
     if (!_evaluated) {
       evaluate();
       _evaluated = true;
@@ -128,6 +172,7 @@ class Timer {
     return _result;
   }
   const Result & evolutionaryResult() {
+    std::lock_guard<std::mutex> lock(_mutex);
     _result.total_evolutionary = 0;
     std::vector<double> time_vector;
     for (const Timing& timing : _timings) {
@@ -140,20 +185,46 @@ class Timer {
     return _result;
   }
 
+  // Evolutionary time added by the calling thread. Evolutionary runs in different
+  // threads (e.g., concurrent calls of the library) thus do not see each other's time.
+  double totalEvolutionaryTime() {
+    return threadEvolutionaryTime();
+  }
+
  private:
   Timer() :
+    _mutex(),
     _current_timing(),
     _start(),
     _end(),
     _timings(),
     _result(),
-    _evaluated(false) {
+    _evaluated(false),
+    _peak_rss(MemoryTracker::peakRSS()) {
     _timings.reserve(1024);
   }
 
+  static double& threadEvolutionaryTime() {
+    static thread_local double evolutionary_time = 0.0;
+    return evolutionary_time;
+  }
+
+  static Timepoint initialPartitioningTimepoint(const Timepoint& timepoint) {
+    switch (timepoint) {
+      case Timepoint::coarsening: return Timepoint::ip_coarsening;
+      case Timepoint::initial_partitioning: return Timepoint::ip_initial_partitioning;
+      case Timepoint::local_search: return Timepoint::ip_local_search;
+      default: return timepoint;
+    }
+  }
+
   void evaluate() {
     int bisection_no = 0;
     for (const Timing& timing : _timings) {
+      const Timepoint timepoint = timing.type == ContextType::initial_partitioning ?
+                                  initialPartitioningTimepoint(timing.timepoint) :
+                                  timing.timepoint;
+      _result.peak_rss_increase[static_cast<size_t>(timepoint)] += timing.peak_rss_increase;
       if (timing.type == ContextType::main) {
         switch (timing.timepoint) {
           case Timepoint::pre_sparsifier:
@@ -240,13 +311,16 @@ class Timer {
     _result.total_preprocessing = _result.pre_sparsifier +
                                   _result.pre_community_detection;
     _result.total_postprocessing = _result.post_sparsifier_restore;
+    _result.peak_rss = MemoryTracker::peakRSS();
   }
 
+  std::mutex _mutex;
   Timepoint _current_timing;
   HighResClockTimepoint _start;
   HighResClockTimepoint _end;
   std::vector<Timing> _timings;
   Result _result;
   bool _evaluated;
+  size_t _peak_rss;
 };
 }  // namespace kahypar
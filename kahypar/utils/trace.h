@@ -0,0 +1,231 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2019 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "kahypar/definitions.h"
+#include "kahypar/macros.h"
+
+namespace kahypar {
+/*!
+ * Records a timeline of nested phases that can be exported in the Chrome trace
+ * event format (chrome://tracing, https://ui.perfetto.dev).
+ *
+ * In contrast to the Timer, which only accumulates the total time spent in each phase,
+ * the recorder keeps each individual span (e.g. every coarsening pass or every flow
+ * refinement of a block pair) together with the thread that executed it. Each traced
+ * partitioning call owns its own recorder, which is shared by all copies of its
+ * context (see PartitionParameters::trace_recorder). Therefore, concurrent calls do
+ * not interfere. Spans of calls without a recorder cost a single null check.
+ */
+class TraceRecorder {
+ public:
+  struct Event {
+    std::string name;
+    const char* category;
+    double begin;     // in microseconds since the recorder was created or cleared
+    double duration;  // in microseconds
+    size_t thread;
+    std::string args;
+  };
+
+  TraceRecorder() :
+    _mutex(),
+    _origin(std::chrono::high_resolution_clock::now().time_since_epoch().count()),
+    _events(),
+    _threads() { }
+
+  TraceRecorder(const TraceRecorder&) = delete;
+  TraceRecorder& operator= (const TraceRecorder&) = delete;
+
+  TraceRecorder(TraceRecorder&&) = delete;
+  TraceRecorder& operator= (TraceRecorder&&) = delete;
+
+  ~TraceRecorder() = default;
+
+  // Discards all previously recorded events and restarts the clock.
+  void clear() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _origin.store(std::chrono::high_resolution_clock::now().time_since_epoch().count(),
+                  std::memory_order_relaxed);
+    _events.clear();
+    _threads.clear();
+  }
+
+  // Can be called concurrently to clear(), since the origin is stored atomically.
+  double now() const {
+    const HighResClockTimepoint origin(HighResClockTimepoint::duration(
+                                         _origin.load(std::memory_order_relaxed)));
+    return std::chrono::duration<double, std::micro>(
+      std::chrono::high_resolution_clock::now() - origin).count();
+  }
+
+  // Escapes quotes, backslashes and control characters for use in a JSON string.
+  static std::string escapeJson(const std::string& str) {
+    std::ostringstream os;
+    for (const char c : str) {
+      switch (c) {
+        case '"': os << "\\\""; break;
+        case '\\': os << "\\\\"; break;
+        case '\n': os << "\\n"; break;
+        case '\t': os << "\\t"; break;
+        default:
+          if (static_cast<unsigned char>(c) < 0x20) {
+            os << "\\u" << std::hex << std::setw(4) << std::setfill('0')
+               << static_cast<int>(c) << std::dec;
+          } else {
+            os << c;
+          }
+      }
+    }
+    return os.str();
+  }
+
+  void record(std::string name, const char* category, const double begin,
+              const double end, std::string args) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    const auto thread = _threads.emplace(std::this_thread::get_id(), _threads.size()).first;
+    _events.push_back(Event { std::move(name), category, begin, end - begin,
+                              thread->second, std::move(args) });
+  }
+
+  std::vector<Event> events() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _events;
+  }
+
+  void writeChromeTrace(std::ostream& out) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    for (size_t i = 0; i < _events.size(); ++i) {
+      const Event& event = _events[i];
+      out << (i == 0 ? "\n" : ",\n")
+          << "{\"name\":\"" << escapeJson(event.name) << "\",\"cat\":\""
+          << escapeJson(event.category)
+          << "\",\"ph\":\"X\",\"ts\":" << event.begin << ",\"dur\":" << event.duration
+          << ",\"pid\":1,\"tid\":" << event.thread << ",\"args\":{" << event.args << "}}";
+    }
+    out << "\n]}\n";
+  }
+
+  bool writeChromeTrace(const std::string& filename) {
+    std::ofstream file(filename, std::ios::trunc);
+    file.setf(std::ios::fixed);
+    file.precision(3);
+    writeChromeTrace(file);
+    if (!file) {
+      LOG << "Error: Could not write trace file" << filename;
+      return false;
+    }
+    return true;
+  }
+
+ private:
+  std::mutex _mutex;
+  // time_since_epoch().count() of the time point at which the recorder was created or cleared
+  std::atomic<HighResClockTimepoint::rep> _origin;
+  std::vector<Event> _events;
+  std::unordered_map<std::thread::id, size_t> _threads;
+};
+
+/*!
+ * RAII span of a TraceRecorder: The span starts on construction and is recorded
+ * on destruction (or on an explicit call to end()). If the recorder is null,
+ * nothing is recorded.
+ */
+class TraceSpan {
+ public:
+  TraceSpan(const std::shared_ptr<TraceRecorder>& recorder, const char* name,
+            const char* category) :
+    _recorder(recorder.get()),
+    _active(_recorder != nullptr),
+    _name(name),
+    _category(category),
+    _args(),
+    _begin(_active ? _recorder->now() : 0.0) { }
+
+  TraceSpan(const TraceSpan&) = delete;
+  TraceSpan& operator= (const TraceSpan&) = delete;
+
+  TraceSpan(TraceSpan&&) = delete;
+  TraceSpan& operator= (TraceSpan&&) = delete;
+
+  ~TraceSpan() {
+    end();
+  }
+
+  // Arguments are shown in the details view of the timeline viewer.
+  template <typename T>
+  TraceSpan & arg(const char* key, const T& value) {
+    if (_active) {
+      std::ostringstream value_os;
+      value_os << std::boolalpha << value;
+      std::ostringstream os;
+      os << (_args.empty() ? "" : ",") << "\"" << TraceRecorder::escapeJson(key) << "\":";
+      if (std::is_arithmetic<T>::value) {
+        os << value_os.str();
+      } else {
+        os << "\"" << TraceRecorder::escapeJson(value_os.str()) << "\"";
+      }
+      _args += os.str();
+    }
+    return *this;
+  }
+
+  void end() {
+    if (_active) {
+      _recorder->record(_name, _category, _begin, _recorder->now(), std::move(_args));
+      _active = false;
+    }
+  }
+
+  // Records the current span and starts a new one with the same name.
+  void restart() {
+    end();
+    _active = _recorder != nullptr;
+    _args.clear();
+    _begin = _active ? _recorder->now() : 0.0;
+  }
+
+ private:
+  TraceRecorder* _recorder;
+  bool _active;
+  const char* _name;
+  const char* _category;
+  std::string _args;
+  double _begin;
+};
+}  // namespace kahypar
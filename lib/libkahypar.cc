@@ -20,7 +20,10 @@
 
 #include "libkahypar.h"
 
+#include <vector>
+
 #include "kahypar/application/command_line_options.h"
+#include "kahypar/batch_partitioner.h"
 #include "kahypar/io/hypergraph_io.h"
 #include "kahypar/macros.h"
 #include "kahypar/partition/context.h"
@@ -28,8 +31,38 @@
 #include "kahypar/utils/randomize.h"
 
 
+static_assert(static_cast<int>(kahypar::ProgressPhase::finished) == KAHYPAR_PHASE_FINISHED,
+              "kahypar_phase_t has to match kahypar::ProgressPhase");
+
 kahypar_context_t* kahypar_context_new() {
-  return reinterpret_cast<kahypar_context_t*>(new kahypar::Context());
+  kahypar::Context* context = new kahypar::Context();
+  // Created up front, such that kahypar_cancel can be called concurrently to kahypar_partition.
+  context->partition.control = std::make_shared<kahypar::PartitioningControl>();
+  return reinterpret_cast<kahypar_context_t*>(context);
+}
+
+void kahypar_set_progress_callback(kahypar_context_t* kahypar_context,
+                                   kahypar_progress_callback_t callback,
+                                   void* user_data) {
+  kahypar::Context& context = *reinterpret_cast<kahypar::Context*>(kahypar_context);
+  if (callback == nullptr) {
+    context.partition.control->setCallback(nullptr);
+    return;
+  }
+  context.partition.control->setCallback(
+    [callback, user_data](const kahypar::ProgressPhase phase,
+                          const kahypar::HyperedgeWeight objective,
+                          const double imbalance) {
+      callback(static_cast<kahypar_phase_t>(phase), objective, imbalance, user_data);
+    });
+}
+
+void kahypar_set_deadline(kahypar_context_t* kahypar_context, const double seconds) {
+  reinterpret_cast<kahypar::Context*>(kahypar_context)->partition.deadline = seconds;
+}
+
+void kahypar_cancel(kahypar_context_t* kahypar_context) {
+  reinterpret_cast<kahypar::Context*>(kahypar_context)->partition.control->cancel();
 }
 
 void kahypar_set_custom_target_block_weights(const kahypar_partition_id_t num_blocks,
@@ -132,6 +165,40 @@ void kahypar_partition(const kahypar_hypernode_id_t num_vertices,
 }
 
 
+void kahypar_partition_batch(const size_t num_hypergraphs,
+                             const kahypar_hypernode_id_t* num_vertices,
+                             const kahypar_hyperedge_id_t* num_hyperedges,
+                             const double* epsilons,
+                             const kahypar_partition_id_t* num_blocks,
+                             const kahypar_hypernode_weight_t* const* vertex_weights,
+                             const kahypar_hyperedge_weight_t* const* hyperedge_weights,
+                             const size_t* const* hyperedge_indices,
+                             const kahypar_hyperedge_id_t* const* hyperedges,
+                             const size_t num_threads,
+                             kahypar_hyperedge_weight_t* objectives,
+                             kahypar_context_t* kahypar_context,
+                             kahypar_partition_id_t* const* partitions) {
+  const kahypar::Context& context = *reinterpret_cast<kahypar::Context*>(kahypar_context);
+
+  std::vector<kahypar::BatchInstance> instances;
+  instances.reserve(num_hypergraphs);
+  for (size_t i = 0; i < num_hypergraphs; ++i) {
+    ASSERT(partitions[i] != nullptr);
+    instances.push_back({ num_vertices[i],
+                          num_hyperedges[i],
+                          hyperedge_indices[i],
+                          hyperedges[i],
+                          hyperedge_weights == nullptr ? nullptr : hyperedge_weights[i],
+                          vertex_weights == nullptr ? nullptr : vertex_weights[i],
+                          static_cast<kahypar::PartitionID>(num_blocks[i]),
+                          epsilons[i],
+                          reinterpret_cast<kahypar::PartitionID*>(partitions[i]),
+                          &objectives[i] });
+  }
+
+  kahypar::BatchPartitioner(context, num_threads).partition(instances);
+}
+
 void kahypar_improve_partition(const kahypar_hypernode_id_t num_vertices,
                                const kahypar_hyperedge_id_t num_hyperedges,
                                const double epsilon,
@@ -21,9 +21,17 @@
 
 #include <pybind11/pybind11.h>
 
+#include <pybind11/numpy.h>
 #include <pybind11/stl.h>
 
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
 #include <string>
+#include <tuple>
+#include <unordered_set>
+#include <vector>
 
 #include "kahypar/definitions.h"
 
@@ -33,18 +41,194 @@
 #include "kahypar/application/command_line_options.h"
 #include "kahypar/datastructure/connectivity_sets.h"
 #include "kahypar/partition/metrics.h"
+#include "kahypar/batch_partitioner.h"
+
+namespace py = pybind11;
+
+// NumPy arrays are passed without copying if they are C-contiguous and have the
+// required dtype. Otherwise, NumPy converts them once.
+template <typename T>
+using Array = py::array_t<T, py::array::c_style | py::array::forcecast>;
+
+template <typename T>
+Array<T> toArray(const py::object& values) {
+  Array<T> array = Array<T>::ensure(values);
+  if (!array) {
+    throw py::error_already_set();
+  }
+  if (array.ndim() != 1) {
+    throw std::invalid_argument("Hypergraph arrays have to be one-dimensional");
+  }
+  return array;
+}
+
+template <typename T>
+Array<T> weightArray(const py::object& weights, const size_t expected_size) {
+  if (weights.is_none()) {
+    return Array<T>();
+  }
+  Array<T> array = toArray<T>(weights);
+  if (array.size() != 0 && static_cast<size_t>(array.size()) != expected_size) {
+    throw std::invalid_argument("Weight arrays have to contain one weight per element");
+  }
+  return array;
+}
+
+// The hypergraph constructors do not check their input. Invalid indices or pins
+// would lead to out-of-bounds accesses, so they are rejected with a ValueError.
+void checkHypergraphArrays(const kahypar::HypernodeID num_nodes,
+                           const kahypar::HyperedgeID num_edges,
+                           const size_t* indices, const size_t num_indices,
+                           const kahypar::HypernodeID* pins, const size_t num_pins) {
+  if (num_indices != static_cast<size_t>(num_edges) + 1 || indices[0] != 0 ||
+      num_pins != indices[num_edges]) {
+    throw std::invalid_argument("Index and edge arrays do not match the number of hyperedges");
+  }
+  for (size_t i = 0; i < num_edges; ++i) {
+    if (indices[i] > indices[i + 1]) {
+      throw std::invalid_argument("Index array has to be non-decreasing");
+    }
+  }
+  for (size_t i = 0; i < num_pins; ++i) {
+    if (pins[i] >= num_nodes) {
+      throw std::invalid_argument("Edge array contains a pin that is not a valid node id");
+    }
+  }
+}
+
+std::unique_ptr<kahypar::Hypergraph>
+createHypergraphFromArrays(const kahypar::HypernodeID num_nodes,
+                           const kahypar::HyperedgeID num_edges,
+                           const py::array& index_vector,
+                           const py::object& edge_vector,
+                           const kahypar::PartitionID k,
+                           const py::object& edge_weights,
+                           const py::object& node_weights) {
+  const auto indices = toArray<size_t>(index_vector);
+  const auto pins = toArray<kahypar::HypernodeID>(edge_vector);
+  if (indices.size() == 0) {
+    throw std::invalid_argument("Index arrays have to contain at least one entry");
+  }
+  checkHypergraphArrays(num_nodes, num_edges, indices.data(), indices.size(),
+                        pins.data(), pins.size());
+  const auto hyperedge_weights = weightArray<kahypar::HyperedgeWeight>(edge_weights, num_edges);
+  const auto hypernode_weights = weightArray<kahypar::HypernodeWeight>(node_weights, num_nodes);
+  return std::unique_ptr<kahypar::Hypergraph>(new kahypar::Hypergraph(
+    num_nodes, num_edges, indices.data(), pins.data(), k,
+    hyperedge_weights.size() != 0 ? hyperedge_weights.data() : nullptr,
+    hypernode_weights.size() != 0 ? hypernode_weights.data() : nullptr));
+}
 
 void hello(const std::string& input) {
   std::cout << input << std::endl;
 }
 
+// Partitioning releases the GIL, such that Python threads can partition concurrently.
+// Since hypergraphs and contexts are modified during partitioning, concurrent calls
+// must not share them. Sharing raises an exception instead of corrupting both calls.
+class ExclusiveUse {
+ public:
+  explicit ExclusiveUse(const std::vector<const void*>& objects) :
+    _objects() {
+    std::lock_guard<std::mutex> lock(mutex());
+    for (const void* object : objects) {
+      if (inUse().count(object) > 0) {
+        throw std::runtime_error("Hypergraph or context is used by another partitioning call");
+      }
+    }
+    for (const void* object : objects) {
+      if (inUse().insert(object).second) {
+        _objects.push_back(object);
+      }
+    }
+  }
+
+  ExclusiveUse(const ExclusiveUse&) = delete;
+  ExclusiveUse& operator= (const ExclusiveUse&) = delete;
+
+  ExclusiveUse(ExclusiveUse&&) = delete;
+  ExclusiveUse& operator= (ExclusiveUse&&) = delete;
+
+  ~ExclusiveUse() {
+    std::lock_guard<std::mutex> lock(mutex());
+    for (const void* object : _objects) {
+      inUse().erase(object);
+    }
+  }
+
+ private:
+  static std::mutex& mutex() {
+    static std::mutex mutex;
+    return mutex;
+  }
+
+  static std::unordered_set<const void*>& inUse() {
+    static std::unordered_set<const void*> in_use;
+    return in_use;
+  }
+
+  std::vector<const void*> _objects;
+};
+
 void partition(kahypar::Hypergraph& hypergraph,
                kahypar::Context& context) {
+  ExclusiveUse exclusive_use({ &hypergraph, &context });
+  py::gil_scoped_release release;
   kahypar::PartitionerFacade().partition(hypergraph, context);
 }
 
+std::tuple<std::vector<std::vector<kahypar::PartitionID> >,
+           std::vector<kahypar::HyperedgeWeight> >
+partitionBatch(const std::vector<kahypar::HypernodeID>& num_nodes,
+               const std::vector<kahypar::HyperedgeIndexVector>& index_vectors,
+               const std::vector<kahypar::HyperedgeVector>& edge_vectors,
+               const std::vector<kahypar::PartitionID>& k,
+               const std::vector<double>& epsilon,
+               const kahypar::Context& context,
+               const size_t num_threads,
+               const std::vector<kahypar::HyperedgeWeightVector>& edge_weights,
+               const std::vector<kahypar::HypernodeWeightVector>& node_weights) {
+  const size_t num_hypergraphs = num_nodes.size();
+  if (index_vectors.size() != num_hypergraphs || edge_vectors.size() != num_hypergraphs ||
+      k.size() != num_hypergraphs || epsilon.size() != num_hypergraphs ||
+      (!edge_weights.empty() && edge_weights.size() != num_hypergraphs) ||
+      (!node_weights.empty() && node_weights.size() != num_hypergraphs)) {
+    throw std::invalid_argument("All lists have to contain one entry per hypergraph");
+  }
 
-namespace py = pybind11;
+  std::vector<std::vector<kahypar::PartitionID> > partitions(num_hypergraphs);
+  std::vector<kahypar::HyperedgeWeight> objectives(num_hypergraphs, 0);
+  std::vector<kahypar::BatchInstance> instances;
+  instances.reserve(num_hypergraphs);
+  for (size_t i = 0; i < num_hypergraphs; ++i) {
+    if (index_vectors[i].empty()) {
+      throw std::invalid_argument("Index vectors have to contain at least one entry");
+    }
+    checkHypergraphArrays(num_nodes[i], index_vectors[i].size() - 1,
+                          index_vectors[i].data(), index_vectors[i].size(),
+                          edge_vectors[i].data(), edge_vectors[i].size());
+    partitions[i].resize(num_nodes[i], -1);
+    const bool has_edge_weights = !edge_weights.empty() && !edge_weights[i].empty();
+    const bool has_node_weights = !node_weights.empty() && !node_weights[i].empty();
+    instances.push_back({ num_nodes[i],
+                          static_cast<kahypar::HyperedgeID>(index_vectors[i].size() - 1),
+                          index_vectors[i].data(),
+                          edge_vectors[i].data(),
+                          has_edge_weights ? edge_weights[i].data() : nullptr,
+                          has_node_weights ? node_weights[i].data() : nullptr,
+                          k[i],
+                          epsilon[i],
+                          partitions[i].data(),
+                          &objectives[i] });
+  }
+
+  {
+    ExclusiveUse exclusive_use({ &context });
+    py::gil_scoped_release release;
+    kahypar::BatchPartitioner(context, num_threads).partition(instances);
+  }
+  return std::make_tuple(std::move(partitions), std::move(objectives));
+}
 
 PYBIND11_MODULE(kahypar, m) {
   using kahypar::Hypergraph;
@@ -54,11 +238,45 @@ PYBIND11_MODULE(kahypar, m) {
   using kahypar::HyperedgeVector;
   using kahypar::HyperedgeWeightVector;
   using kahypar::HypernodeWeightVector;
+  using kahypar::HypernodeWeight;
   using kahypar::PartitionID;
   using ConnectivitySet = typename ConnectivitySets<PartitionID, HyperedgeID>::ConnectivitySet;
 
   py::class_<Hypergraph>(
       m, "Hypergraph")
+      // Has to precede the list-based constructors, which would otherwise convert
+      // NumPy arrays element by element. Only matches if index_vector is a NumPy array.
+      .def(py::init([](const HypernodeID num_nodes,
+                       const HyperedgeID num_edges,
+                       const py::array& index_vector,
+                       const py::object& edge_vector,
+                       const PartitionID k,
+                       const py::object& edge_weights,
+                       const py::object& node_weights) {
+             return createHypergraphFromArrays(num_nodes, num_edges, index_vector, edge_vector, k,
+                                               edge_weights, node_weights);
+           }),R"pbdoc(
+Construct a hypergraph from NumPy arrays without converting them to lists.
+
+Arrays that are C-contiguous and have the required dtype (uint64 for index_vector,
+uint32 for edge_vector, int32 for the weights) are read in place.
+
+:param HypernodeID num_nodes: Number of nodes
+:param HyperedgeID num_edges: Number of hyperedges
+:param numpy.ndarray index_vector: Starting indices for each hyperedge
+:param numpy.ndarray edge_vector: Array containing all hyperedges
+:param PartitionID k: Number of blocks in which the hypergraph should be partitioned
+:param numpy.ndarray edge_weights: Weights of all hyperedges (optional)
+:param numpy.ndarray node_weights: Weights of all hypernodes (optional)
+
+          )pbdoc",
+           py::arg("num_nodes"),
+           py::arg("num_edges"),
+           py::arg("index_vector"),
+           py::arg("edge_vector"),
+           py::arg("k"),
+           py::arg("edge_weights") = py::none(),
+           py::arg("node_weights") = py::none())
       .def(py::init<const HypernodeID,
            const HyperedgeID,
            const HyperedgeIndexVector,
@@ -122,6 +340,35 @@ If only one type of weights is required, the other argument has to be an empty l
       .def("blockID", &Hypergraph::partID,
            "Get the block of the node in the current hypergraph partition (before partitioning: -1)",
            py::arg("node"))
+      .def("blockIDs", [](const Hypergraph& h) {
+          Array<PartitionID> block_ids(h.initialNumNodes());
+          PartitionID* data = block_ids.mutable_data();
+          std::fill(data, data + h.initialNumNodes(), -1);
+          for (const HypernodeID& hn : h.nodes()) {
+            data[hn] = h.partID(hn);
+          }
+          return block_ids;
+        },
+        "Get the blocks of all nodes as NumPy array (before partitioning: -1)")
+      .def("blockWeights", [](const Hypergraph& h) {
+          Array<HypernodeWeight> block_weights(h.k());
+          HypernodeWeight* data = block_weights.mutable_data();
+          for (PartitionID block = 0; block < h.k(); ++block) {
+            data[block] = h.partWeight(block);
+          }
+          return block_weights;
+        },
+        "Get the weights of all blocks as NumPy array")
+      .def("connectivities", [](const Hypergraph& h) {
+          Array<PartitionID> connectivities(h.initialNumEdges());
+          PartitionID* data = connectivities.mutable_data();
+          std::fill(data, data + h.initialNumEdges(), 0);
+          for (const HyperedgeID& he : h.edges()) {
+            data[he] = h.connectivity(he);
+          }
+          return connectivities;
+        },
+        "Get the connectivities of all hyperedges as NumPy array")
       .def("numNodes", &Hypergraph::initialNumNodes,
            "Get the number of nodes")
       .def("numEdges", &Hypergraph::initialNumEdges,
@@ -195,9 +442,31 @@ If only one type of weights is required, the other argument has to be an empty l
 
   m.def(
       "partition", &partition,
-      "Compute a k-way partition of the hypergraph",
+      "Compute a k-way partition of the hypergraph (releases the GIL; concurrent calls "
+      "have to use different hypergraphs and contexts)",
       py::arg("hypergraph"), py::arg("context"));
 
+  m.def(
+      "partitionBatch", &partitionBatch, R"pbdoc(
+Partition a batch of hypergraphs in parallel.
+
+:param list num_nodes: Number of nodes of each hypergraph
+:param list index_vectors: Starting indices for each hyperedge of each hypergraph
+:param list edge_vectors: Vector containing all hyperedges of each hypergraph
+:param list k: Number of blocks of each hypergraph
+:param list epsilon: Allowed imbalance of each hypergraph
+:param Context context: Configuration used for all hypergraphs
+:param int num_threads: Number of threads (0: one per hardware thread)
+:param list edge_weights: Hyperedge weights of each hypergraph (optional)
+:param list node_weights: Node weights of each hypergraph (optional)
+:return: Tuple of the block IDs of the nodes and the objective of each hypergraph
+
+          )pbdoc",
+      py::arg("num_nodes"), py::arg("index_vectors"), py::arg("edge_vectors"),
+      py::arg("k"), py::arg("epsilon"), py::arg("context"), py::arg("num_threads") = 0,
+      py::arg("edge_weights") = std::vector<kahypar::HyperedgeWeightVector>(),
+      py::arg("node_weights") = std::vector<kahypar::HypernodeWeightVector>());
+
   m.def(
       "cut", &kahypar::metrics::hyperedgeCut,
       "Compute the cut-net metric for the partitioned hypergraph",
@@ -20,6 +20,9 @@
 
 import unittest
 import os
+import threading
+
+import numpy as np
 
 import kahypar as kahypar
 
@@ -71,6 +74,55 @@ class MainTest(unittest.TestCase):
         self.assertEqual(hypergraph.edgeWeight(3),44)
 
 
+    # build a custom weighted hypergraph from NumPy arrays
+    def test_construct_hypergraph_from_numpy_arrays(self):
+        hyperedge_indices = np.array([0,2,6,9,12], dtype=np.uint64)
+        hyperedges = np.array([0,2,0,1,3,4,3,4,6,2,5,6], dtype=np.uint32)
+        node_weights = np.arange(1, 8, dtype=np.int32)
+        edge_weights = np.array([11,22,33,44], dtype=np.int64)
+
+        hypergraph = kahypar.Hypergraph(7, 4, hyperedge_indices, hyperedges, 2,
+                                        edge_weights=edge_weights, node_weights=node_weights)
+
+        self.assertEqual(hypergraph.numNodes(),7)
+        self.assertEqual(hypergraph.numEdges(),4)
+        self.assertEqual(hypergraph.numPins(),12)
+        self.assertEqual([hypergraph.nodeWeight(hn) for hn in range(7)], list(node_weights))
+        self.assertEqual([hypergraph.edgeWeight(he) for he in range(4)], list(edge_weights))
+
+        with self.assertRaises(ValueError):
+            kahypar.Hypergraph(7, 3, hyperedge_indices, hyperedges, 2)
+        # pin 6 is not a node of a hypergraph with 6 nodes
+        with self.assertRaises(ValueError):
+            kahypar.Hypergraph(6, 4, hyperedge_indices, hyperedges, 2)
+        with self.assertRaises(ValueError):
+            kahypar.Hypergraph(7, 4, np.array([0,6,2,9,12], dtype=np.uint64), hyperedges, 2)
+        with self.assertRaises(ValueError):
+            kahypar.Hypergraph(7, 4, np.array([1,2,6,9,12], dtype=np.uint64), hyperedges, 2)
+
+    # query the partition of a hypergraph as NumPy arrays
+    def test_bulk_accessors(self):
+        context = kahypar.Context()
+        context.loadINIconfiguration(mydir+"/../..//config/km1_kKaHyPar_dissertation.ini")
+        context.suppressOutput(True)
+        context.setK(2)
+        context.setEpsilon(0.03)
+
+        hypergraph = kahypar.Hypergraph(7, 4, np.array([0,2,6,9,12]),
+                                        np.array([0,2,0,1,3,4,3,4,6,2,5,6]), 2)
+        self.assertTrue(np.all(hypergraph.blockIDs() == -1))
+
+        kahypar.partition(hypergraph, context)
+
+        self.assertEqual(list(hypergraph.blockIDs()),
+                         [hypergraph.blockID(hn) for hn in hypergraph.nodes()])
+        self.assertEqual(list(hypergraph.blockWeights()),
+                         [hypergraph.blockWeight(block) for block in range(2)])
+        self.assertEqual(list(hypergraph.connectivities()),
+                         [hypergraph.connectivity(he) for he in hypergraph.edges()])
+        self.assertEqual(np.sum(hypergraph.connectivities() - 1),
+                         kahypar.connectivityMinusOne(hypergraph))
+
     # construct hypergraph from file
     def test_construct_hypergraph_from_file(self):
         ibm01 = kahypar.createHypergraphFromFile(mydir+"/ISPD98_ibm01.hgr",2)
@@ -96,5 +148,50 @@ class MainTest(unittest.TestCase):
         self.assertEqual(kahypar.connectivityMinusOne(ibm01), 202)
         self.assertEqual(kahypar.imbalance(ibm01,context), 0.027603513174403904)
 
+    # partition a batch of hypergraphs
+    def test_partition_batch(self):
+        context = kahypar.Context()
+        context.loadINIconfiguration(mydir+"/../..//config/km1_kKaHyPar_dissertation.ini")
+        context.suppressOutput(True)
+
+        num_nodes = [7, 6]
+        index_vectors = [[0, 2, 6, 9, 12], [0, 3, 6, 8]]
+        edge_vectors = [[0, 2, 0, 1, 3, 4, 3, 4, 6, 2, 5, 6], [0, 1, 2, 3, 4, 5, 2, 3]]
+        k = [2, 2]
+        epsilon = [0.03, 0.1]
+
+        partitions, objectives = kahypar.partitionBatch(num_nodes, index_vectors, edge_vectors,
+                                                        k, epsilon, context, num_threads=2)
+
+        for i in range(len(num_nodes)):
+            hypergraph = kahypar.Hypergraph(num_nodes[i], len(index_vectors[i]) - 1,
+                                            index_vectors[i], edge_vectors[i], k[i])
+            context.setK(k[i])
+            context.setEpsilon(epsilon[i])
+            kahypar.partition(hypergraph, context)
+            self.assertEqual(partitions[i], [hypergraph.blockID(hn) for hn in hypergraph.nodes()])
+            self.assertEqual(objectives[i], kahypar.connectivityMinusOne(hypergraph))
+
+    # partition hypergraphs concurrently from Python threads
+    def test_partition_concurrently(self):
+        def partition(results, i):
+            context = kahypar.Context()
+            context.loadINIconfiguration(mydir+"/../..//config/km1_kKaHyPar_dissertation.ini")
+            context.suppressOutput(True)
+            context.setK(2)
+            context.setEpsilon(0.03)
+            ibm01 = kahypar.createHypergraphFromFile(mydir+"/ISPD98_ibm01.hgr",2)
+            kahypar.partition(ibm01, context)
+            results[i] = kahypar.connectivityMinusOne(ibm01)
+
+        results = [None] * 2
+        threads = [threading.Thread(target=partition, args=(results, i)) for i in range(2)]
+        for thread in threads:
+            thread.start()
+        for thread in threads:
+            thread.join()
+
+        self.assertEqual(results, [202, 202])
+
 if __name__ == '__main__':
     unittest.main()
@@ -83,6 +83,7 @@ if __name__ == '__main__':
         author_email='kahypar@sebastianschlag.de',
         ext_modules=[CMakeExtension('kahypar')],
         cmdclass=dict(build_ext=CMakeBuild),
+        install_requires=['numpy'],
         zip_safe=False,
         # use MANIFEST.in for extra source files
         include_package_data=True,
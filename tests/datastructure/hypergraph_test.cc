@@ -806,11 +806,60 @@ TEST_F(AHypergraph, WithContractedHypernodesCanBeReindexed) {
               ContainerEq(std::vector<PartitionID>{ 0, 2, 6, 10, 12 }));
 }
 
+TEST_F(AHypergraph, WithContractedHypernodesKeepsIncidentNetsAndFixedVerticesWhenReindexed) {
+  hypergraph.setFixedVertex(3, 1);
+  hypergraph.setFixedVertex(6, 0);
+  hypergraph.contract(1, 4);
+  hypergraph.contract(0, 2);
+  hypergraph.removeEdge(1);
+
+  auto reindexed = reindex(hypergraph);
+  const Hypergraph& reindexed_hypergraph = *reindexed.first;
+
+  for (const HypernodeID& hn : reindexed_hypergraph.nodes()) {
+    const HypernodeID original_hn = reindexed.second[hn];
+    ASSERT_THAT(reindexed_hypergraph.nodeDegree(hn), Eq(hypergraph.nodeDegree(original_hn)));
+    ASSERT_THAT(reindexed_hypergraph.nodeWeight(hn), Eq(hypergraph.nodeWeight(original_hn)));
+    for (const HyperedgeID& he : reindexed_hypergraph.incidentEdges(hn)) {
+      const auto pins = reindexed_hypergraph.pins(he);
+      ASSERT_THAT(std::find(pins.first, pins.second, hn) != pins.second, Eq(true));
+    }
+  }
+  ASSERT_THAT(reindexed_hypergraph.numFixedVertices(), Eq(2));
+  ASSERT_THAT(reindexed_hypergraph.fixedVertexPartID(2), Eq(1));
+  ASSERT_THAT(reindexed_hypergraph.fixedVertexPartID(4), Eq(0));
+  ASSERT_THAT(reindexed_hypergraph.totalWeight(), Eq(hypergraph.totalWeight()));
+}
+
 TEST_F(APartitionedHypergraph, CanBeResetToUnpartitionedState) {
   hypergraph.resetPartitioning();
   ASSERT_THAT(verifyEquivalenceWithPartitionInfo(hypergraph, original_hypergraph), Eq(true));
 }
 
+TEST_F(AHypergraph, ResetsAllPinCountsOfAKWayPartition) {
+  hypergraph.changeK(4);
+  hypergraph.setNodePart(0, 0);
+  hypergraph.setNodePart(1, 1);
+  hypergraph.setNodePart(2, 2);
+  hypergraph.setNodePart(3, 3);
+  hypergraph.setNodePart(4, 3);
+  hypergraph.setNodePart(5, 0);
+  hypergraph.setNodePart(6, 1);
+  hypergraph.resetPartitioning();
+
+  for (const HyperedgeID& he : hypergraph.edges()) {
+    ASSERT_THAT(hypergraph.connectivity(he), Eq(0));
+    for (PartitionID part = 0; part < 4; ++part) {
+      ASSERT_THAT(hypergraph.pinCountInPart(he, part), Eq(0));
+    }
+  }
+  for (const HypernodeID& hn : hypergraph.nodes()) {
+    hypergraph.setNodePart(hn, 2);
+  }
+  ASSERT_THAT(hypergraph.pinCountInPart(1, 2), Eq(4));
+  ASSERT_THAT(hypergraph.connectivity(1), Eq(1));
+}
+
 
 TEST_F(APartitionedHypergraph, IdentifiesBorderHypernodes) {
   hypergraph.initializeNumCutHyperedges();
@@ -1057,6 +1106,12 @@ TEST(Hypergraphs, CanBeStrippedOfAllParallelHyperedges) {
   ASSERT_EQ(hypergraph.edgeWeight(3), 1);
 }
 
+TEST_F(AHypergraph, ReportsItsMemoryConsumption) {
+  ASSERT_EQ(hypergraph.pinsInPartSizeInBytes(), 4 * 2 * sizeof(HypernodeID));
+  // incidence array and incident nets of the hypernodes
+  ASSERT_GE(hypergraph.sizeInBytes(), 2 * 12 * sizeof(HypernodeID));
+}
+
 TEST(Hypergraphs, CanBeStrippedOfAllIdenticalVertices) {
   Hypergraph hypergraph(7, 2, HyperedgeIndexVector { 0, 5, 10 },
                         HyperedgeVector { 6, 1, 0, 2, 5, 3, 5, 4, 0, 6 });
@@ -0,0 +1,146 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2019 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#include <limits>
+#include <vector>
+
+#include "gmock/gmock.h"
+
+#include "kahypar/datastructure/integer_bucket_queue.h"
+#include "kahypar/datastructure/kway_priority_queue.h"
+#include "kahypar/definitions.h"
+
+using ::testing::Eq;
+using ::testing::Test;
+
+namespace kahypar {
+namespace ds {
+class AnIntegerBucketQueue : public Test {
+ public:
+  AnIntegerBucketQueue() :
+    queue(20, 10) { }
+
+  IntegerBucketMaxQueue<HypernodeID, Gain> queue;
+};
+
+TEST_F(AnIntegerBucketQueue, IsEmptyWhenCreated) {
+  ASSERT_THAT(queue.empty(), Eq(true));
+}
+
+TEST_F(AnIntegerBucketQueue, ContainsPushedElements) {
+  queue.push(3, 5);
+  queue.push(7, -2);
+  ASSERT_THAT(queue.size(), Eq(2));
+  ASSERT_THAT(queue.contains(3), Eq(true));
+  ASSERT_THAT(queue.contains(7), Eq(true));
+  ASSERT_THAT(queue.contains(4), Eq(false));
+  ASSERT_THAT(queue.getKey(7), Eq(-2));
+}
+
+TEST_F(AnIntegerBucketQueue, ReturnsElementsInDecreasingOrder) {
+  const std::vector<Gain> keys = { 3, -10, 7, 0, 10, -4, 7, 1 };
+  for (HypernodeID i = 0; i < keys.size(); ++i) {
+    queue.push(i, keys[i]);
+  }
+  Gain last = std::numeric_limits<Gain>::max();
+  while (!queue.empty()) {
+    ASSERT_THAT(queue.topKey() <= last, Eq(true));
+    ASSERT_THAT(queue.getKey(queue.top()), Eq(queue.topKey()));
+    last = queue.topKey();
+    queue.pop();
+  }
+  ASSERT_THAT(last, Eq(-10));
+}
+
+TEST_F(AnIntegerBucketQueue, MovesElementsOnKeyUpdates) {
+  queue.push(0, 4);
+  queue.push(1, 2);
+  queue.updateKeyBy(1, 3);
+  ASSERT_THAT(queue.top(), Eq(1));
+  ASSERT_THAT(queue.topKey(), Eq(5));
+  queue.updateKey(1, -7);
+  ASSERT_THAT(queue.top(), Eq(0));
+  queue.updateKeyBy(0, -12);
+  ASSERT_THAT(queue.top(), Eq(1));
+  ASSERT_THAT(queue.topKey(), Eq(-7));
+  queue.pop();
+  ASSERT_THAT(queue.top(), Eq(0));
+  ASSERT_THAT(queue.topKey(), Eq(-8));
+}
+
+TEST_F(AnIntegerBucketQueue, ReturnsElementsWithEqualKeysInFIFOOrder) {
+  queue.push(2, 3);
+  queue.push(0, 3);
+  queue.push(1, 3);
+  queue.updateKeyBy(2, 0);
+  ASSERT_THAT(queue.top(), Eq(2));
+  queue.pop();
+  ASSERT_THAT(queue.top(), Eq(0));
+  queue.pop();
+  ASSERT_THAT(queue.top(), Eq(1));
+}
+
+TEST_F(AnIntegerBucketQueue, RemovesArbitraryElements) {
+  queue.push(0, 4);
+  queue.push(1, 2);
+  queue.push(2, 4);
+  queue.remove(0);
+  queue.remove(2);
+  ASSERT_THAT(queue.size(), Eq(1));
+  ASSERT_THAT(queue.contains(0), Eq(false));
+  ASSERT_THAT(queue.top(), Eq(1));
+}
+
+TEST_F(AnIntegerBucketQueue, IsEmptyAfterClear) {
+  queue.push(0, 4);
+  queue.push(1, -2);
+  queue.clear();
+  ASSERT_THAT(queue.empty(), Eq(true));
+  ASSERT_THAT(queue.contains(0), Eq(false));
+  ASSERT_THAT(queue.contains(1), Eq(false));
+  queue.push(1, -9);
+  ASSERT_THAT(queue.top(), Eq(1));
+}
+
+TEST(AKWayIntegerBucketQueue, ReturnsTheMaximumOverAllParts) {
+  KWayPriorityQueue<HypernodeID, Gain, std::numeric_limits<Gain>, false,
+                    IntegerBucketMaxQueue<HypernodeID, Gain> > pq(3);
+  pq.initialize(10, 5);
+  pq.insert(0, 0, 2);
+  pq.insert(1, 1, -3);
+  pq.insert(2, 2, 4);
+  pq.enablePart(0);
+  pq.enablePart(1);
+  pq.enablePart(2);
+  pq.updateKeyBy(1, 1, 8);
+
+  HypernodeID max_id = 0;
+  Gain max_gain = 0;
+  PartitionID max_part = 0;
+  pq.deleteMax(max_id, max_gain, max_part);
+  ASSERT_THAT(max_id, Eq(1));
+  ASSERT_THAT(max_gain, Eq(5));
+  ASSERT_THAT(max_part, Eq(1));
+  pq.deleteMax(max_id, max_gain, max_part);
+  ASSERT_THAT(max_id, Eq(2));
+  ASSERT_THAT(max_part, Eq(2));
+}
+}  // namespace ds
+}  // namespace kahypar
@@ -0,0 +1,140 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2019 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "gmock/gmock.h"
+
+#include "kahypar/datastructure/packed_integer_array.h"
+
+using ::testing::Eq;
+using ::testing::ContainerEq;
+using ::testing::Test;
+
+namespace kahypar {
+namespace ds {
+TEST(APackedIntegerArray, UsesMinimalNumberOfBitsPerEntry) {
+  ASSERT_THAT(PackedIntegerArray(10, 0).bitsPerEntry(), Eq(1));
+  ASSERT_THAT(PackedIntegerArray(10, 1).bitsPerEntry(), Eq(1));
+  ASSERT_THAT(PackedIntegerArray(10, 2).bitsPerEntry(), Eq(2));
+  ASSERT_THAT(PackedIntegerArray(10, 3).bitsPerEntry(), Eq(2));
+  ASSERT_THAT(PackedIntegerArray(10, 7).bitsPerEntry(), Eq(3));
+  ASSERT_THAT(PackedIntegerArray(10, 127).bitsPerEntry(), Eq(7));
+  ASSERT_THAT(PackedIntegerArray(10, 128).bitsPerEntry(), Eq(8));
+}
+
+TEST(APackedIntegerArray, StoresAndOverwritesEntries) {
+  // 3 bits per entry, i.e. 21 entries per word
+  PackedIntegerArray array(100, 5);
+  for (size_t i = 0; i < array.size(); ++i) {
+    array.set(i, i % 6);
+  }
+  for (size_t i = 0; i < array.size(); ++i) {
+    ASSERT_THAT(array.get(i), Eq(i % 6));
+  }
+  array.set(20, 0);
+  array.set(21, 5);
+  ASSERT_THAT(array.get(19), Eq(19 % 6));
+  ASSERT_THAT(array.get(20), Eq(0));
+  ASSERT_THAT(array.get(21), Eq(5));
+  ASSERT_THAT(array.get(22), Eq(22 % 6));
+  ASSERT_THAT(array.sizeInBytes(), Eq(5 * sizeof(PackedIntegerArray::Word)));
+}
+
+TEST(APackedIntegerArray, VisitsAllNonzeroEntriesInIncreasingOrder) {
+  PackedIntegerArray array(200, 6);
+  array.set(0, 1);
+  array.set(20, 6);
+  array.set(21, 4);
+  array.set(199, 3);
+  std::vector<std::pair<size_t, uint32_t> > entries;
+  array.forEachNonzero([&](const size_t i, const uint32_t value) {
+      entries.emplace_back(i, value);
+    });
+  ASSERT_THAT(entries, ContainerEq(std::vector<std::pair<size_t, uint32_t> >{
+    { 0, 1 }, { 20, 6 }, { 21, 4 }, { 199, 3 } }));
+}
+
+TEST(APackedIntegerArray, VisitsTheNonzeroEntriesOfARange) {
+  PackedIntegerArray array(200, 1);
+  array.set(0, 1);
+  array.set(63, 1);
+  array.set(64, 1);
+  array.set(130, 1);
+  array.set(199, 1);
+  std::vector<size_t> entries;
+  array.forEachNonzero(63, 131, [&](const size_t i, const uint32_t value) {
+      ASSERT_THAT(value, Eq(1));
+      entries.push_back(i);
+    });
+  ASSERT_THAT(entries, ContainerEq(std::vector<size_t>{ 63, 64, 130 }));
+}
+
+TEST(APackedIntegerArray, VisitsAllEntriesThatDifferFromAnotherArray) {
+  PackedIntegerArray array(200, 6);
+  PackedIntegerArray other(200, 6);
+  array.set(5, 2);
+  other.set(5, 2);
+  array.set(20, 6);
+  other.set(20, 1);
+  other.set(100, 3);
+  std::vector<std::pair<uint32_t, uint32_t> > differences;
+  array.forEachDifference(other, [&](const size_t i, const uint32_t lhs, const uint32_t rhs) {
+      ASSERT_THAT(array.get(i), Eq(lhs));
+      ASSERT_THAT(other.get(i), Eq(rhs));
+      differences.emplace_back(lhs, rhs);
+    });
+  ASSERT_THAT(differences, ContainerEq(std::vector<std::pair<uint32_t, uint32_t> >{
+    { 6, 1 }, { 0, 3 } }));
+}
+
+TEST(APackedIntegerArray, CanBeWrittenAndReadAgain) {
+  PackedIntegerArray array(100, 5);
+  for (size_t i = 0; i < array.size(); ++i) {
+    array.set(i, i % 6);
+  }
+  std::stringstream stream;
+  array.write(stream);
+
+  PackedIntegerArray read_array;
+  ASSERT_THAT(read_array.read(stream, 100, 5), Eq(true));
+  ASSERT_THAT(read_array.size(), Eq(100));
+  for (size_t i = 0; i < read_array.size(); ++i) {
+    ASSERT_THAT(read_array.get(i), Eq(i % 6));
+  }
+}
+
+TEST(APackedIntegerArray, RejectsArraysOfUnexpectedSizeOrBitWidth) {
+  std::stringstream stream;
+  PackedIntegerArray(100, 5).write(stream);
+  const std::string data = stream.str();
+
+  std::stringstream wrong_size(data);
+  ASSERT_THAT(PackedIntegerArray().read(wrong_size, 99, 5), Eq(false));
+  std::stringstream wrong_bits(data);
+  ASSERT_THAT(PackedIntegerArray().read(wrong_bits, 100, 8), Eq(false));
+  std::stringstream truncated(data.substr(0, data.size() - 1));
+  ASSERT_THAT(PackedIntegerArray().read(truncated, 100, 5), Eq(false));
+}
+}  // namespace ds
+}  // namespace kahypar
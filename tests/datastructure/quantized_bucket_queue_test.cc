@@ -0,0 +1,119 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2019 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#include <limits>
+#include <vector>
+
+#include "gmock/gmock.h"
+
+#include "kahypar/datastructure/quantized_bucket_queue.h"
+#include "kahypar/definitions.h"
+
+using ::testing::Eq;
+using ::testing::Test;
+
+namespace kahypar {
+namespace ds {
+class AQuantizedBucketQueue : public Test {
+ public:
+  AQuantizedBucketQueue() :
+    queue(20) { }
+
+  QuantizedBucketMaxQueue<HypernodeID, RatingType> queue;
+};
+
+TEST_F(AQuantizedBucketQueue, IsEmptyWhenCreated) {
+  ASSERT_THAT(queue.empty(), Eq(true));
+}
+
+TEST_F(AQuantizedBucketQueue, ContainsPushedElements) {
+  queue.push(3, 1.5);
+  queue.push(7, 0.25);
+  ASSERT_THAT(queue.size(), Eq(2));
+  ASSERT_THAT(queue.contains(3), Eq(true));
+  ASSERT_THAT(queue.contains(7), Eq(true));
+  ASSERT_THAT(queue.contains(4), Eq(false));
+  ASSERT_THAT(queue.getKey(3), Eq(1.5));
+}
+
+TEST_F(AQuantizedBucketQueue, ReturnsTheMaximumElement) {
+  queue.push(0, 4.0);
+  queue.push(1, 0.125);
+  queue.push(2, 12.5);
+  queue.push(3, 0.0);
+  ASSERT_THAT(queue.top(), Eq(2));
+  ASSERT_THAT(queue.topKey(), Eq(12.5));
+}
+
+TEST_F(AQuantizedBucketQueue, ReturnsElementsInDecreasingOrder) {
+  const std::vector<RatingType> keys = { 3.0, 0.5, 17.0, 1.0, 0.0, 8.25, 2.0 };
+  for (HypernodeID i = 0; i < keys.size(); ++i) {
+    queue.push(i, keys[i]);
+  }
+  RatingType last = std::numeric_limits<RatingType>::max();
+  while (!queue.empty()) {
+    ASSERT_THAT(queue.topKey() <= last, Eq(true));
+    last = queue.topKey();
+    queue.pop();
+  }
+}
+
+TEST_F(AQuantizedBucketQueue, MovesElementsOnKeyUpdate) {
+  queue.push(0, 4.0);
+  queue.push(1, 2.0);
+  queue.updateKey(1, 6.0);
+  ASSERT_THAT(queue.top(), Eq(1));
+  queue.updateKey(1, 1.0);
+  ASSERT_THAT(queue.top(), Eq(0));
+  ASSERT_THAT(queue.getKey(1), Eq(1.0));
+}
+
+TEST_F(AQuantizedBucketQueue, RemovesArbitraryElements) {
+  queue.push(0, 4.0);
+  queue.push(1, 2.0);
+  queue.push(2, 4.0);
+  queue.remove(0);
+  queue.remove(2);
+  ASSERT_THAT(queue.size(), Eq(1));
+  ASSERT_THAT(queue.contains(0), Eq(false));
+  ASSERT_THAT(queue.top(), Eq(1));
+}
+
+TEST_F(AQuantizedBucketQueue, IsEmptyAfterClear) {
+  queue.push(0, 4.0);
+  queue.push(1, 2.0);
+  queue.clear();
+  ASSERT_THAT(queue.empty(), Eq(true));
+  ASSERT_THAT(queue.contains(0), Eq(false));
+  queue.push(0, 1.0);
+  ASSERT_THAT(queue.top(), Eq(0));
+}
+
+TEST_F(AQuantizedBucketQueue, OrdersKeysUpToQuantizationError) {
+  queue.push(0, 1.0);
+  queue.push(1, 1.0 + 1e-6);
+  queue.push(2, 1.01);
+  ASSERT_THAT(queue.top(), Eq(2));
+  queue.pop();
+  // 1.0 and 1.0 + 1e-6 share a bucket, either one is a valid maximum
+  ASSERT_THAT(queue.topKey(), ::testing::DoubleNear(1.0, 1e-5));
+}
+}  // namespace ds
+}  // namespace kahypar
@@ -19,6 +19,8 @@
  ******************************************************************************/
 
 #include <memory>
+#include <utility>
+#include <vector>
 
 #include "gmock/gmock.h"
 
@@ -98,6 +100,135 @@ TEST(KaHyPar, CanBeCalledViaInterface) {
 }
 
 
+void collectPhases(kahypar_phase_t phase, kahypar_hyperedge_weight_t objective,
+                   double, void* user_data) {
+  auto& phases = *reinterpret_cast<std::vector<std::pair<kahypar_phase_t,
+                                                         kahypar_hyperedge_weight_t> >*>(user_data);
+  phases.emplace_back(phase, objective);
+}
+
+TEST(KaHyPar, ReportsProgressViaInterface) {
+  kahypar_context_t* context = kahypar_context_new();
+
+  kahypar_configure_context_from_file(context, "../../../config/km1_direct_kway_sea18.ini");
+
+  const kahypar_hypernode_id_t num_vertices = 7;
+  const kahypar_hyperedge_id_t num_hyperedges = 4;
+  const std::vector<size_t> hyperedge_indices({ 0, 2, 6, 9, 12 });
+  const std::vector<kahypar_hyperedge_id_t> hyperedges({ 0, 2, 0, 1, 3, 4, 3, 4, 6, 2, 5, 6 });
+
+  std::vector<std::pair<kahypar_phase_t, kahypar_hyperedge_weight_t> > phases;
+  kahypar_set_progress_callback(context, collectPhases, &phases);
+
+  kahypar_hyperedge_weight_t objective = 0;
+  std::vector<kahypar_partition_id_t> partition(num_vertices, -1);
+  kahypar_partition(num_vertices, num_hyperedges, 0.03, 2,
+                    /*vertex_weights */ nullptr, /*hyperedge_weights */ nullptr,
+                    hyperedge_indices.data(), hyperedges.data(),
+                    &objective, context, partition.data());
+
+  ASSERT_THAT(phases.size(), ::testing::Ge(4));
+  ASSERT_THAT(phases.front().first, Eq(KAHYPAR_PHASE_PREPROCESSING));
+  ASSERT_THAT(phases.front().second, Eq(-1));
+  ASSERT_THAT(phases.back().first, Eq(KAHYPAR_PHASE_FINISHED));
+  ASSERT_THAT(phases.back().second, Eq(objective));
+
+  kahypar_context_free(context);
+}
+
+TEST(KaHyPar, ReturnsAValidPartitionIfCancelledViaInterface) {
+  kahypar_context_t* context = kahypar_context_new();
+
+  kahypar_configure_context_from_file(context, "../../../config/km1_direct_kway_sea18.ini");
+
+  const kahypar_hypernode_id_t num_vertices = 7;
+  const kahypar_hyperedge_id_t num_hyperedges = 4;
+  const std::vector<size_t> hyperedge_indices({ 0, 2, 6, 9, 12 });
+  const std::vector<kahypar_hyperedge_id_t> hyperedges({ 0, 2, 0, 1, 3, 4, 3, 4, 6, 2, 5, 6 });
+  const kahypar_partition_id_t k = 2;
+
+  kahypar_cancel(context);
+
+  kahypar_hyperedge_weight_t objective = 0;
+  std::vector<kahypar_partition_id_t> partition(num_vertices, -1);
+  kahypar_partition(num_vertices, num_hyperedges, 0.03, k,
+                    /*vertex_weights */ nullptr, /*hyperedge_weights */ nullptr,
+                    hyperedge_indices.data(), hyperedges.data(),
+                    &objective, context, partition.data());
+
+  Hypergraph verification_hypergraph(num_vertices, num_hyperedges, hyperedge_indices,
+                                     hyperedges, k);
+  for (const HypernodeID& hn : verification_hypergraph.nodes()) {
+    ASSERT_THAT(partition[hn], ::testing::Lt(k));
+    verification_hypergraph.setNodePart(hn, partition[hn]);
+  }
+  ASSERT_EQ(objective, metrics::km1(verification_hypergraph));
+
+  // cancellation only affects a single call
+  kahypar_partition(num_vertices, num_hyperedges, 0.03, k,
+                    /*vertex_weights */ nullptr, /*hyperedge_weights */ nullptr,
+                    hyperedge_indices.data(), hyperedges.data(),
+                    &objective, context, partition.data());
+  ASSERT_EQ(objective, 2);
+
+  kahypar_context_free(context);
+}
+
+TEST(KaHyPar, PartitionsBatchesOfHypergraphsViaInterface) {
+  kahypar_context_t* context = kahypar_context_new();
+
+  kahypar_configure_context_from_file(context, "../../../config/km1_direct_kway_sea18.ini");
+  reinterpret_cast<Context*>(context)->partition.quiet_mode = true;
+
+  const size_t num_hypergraphs = 3;
+  const std::vector<kahypar_hypernode_id_t> num_vertices({ 7, 7, 6 });
+  const std::vector<kahypar_hyperedge_id_t> num_hyperedges({ 4, 4, 3 });
+  const std::vector<double> epsilons({ 0.03, 0.5, 0.1 });
+  const std::vector<kahypar_partition_id_t> num_blocks({ 2, 3, 2 });
+  const std::vector<std::vector<size_t> > hyperedge_indices({ { 0, 2, 6, 9, 12 },
+                                                              { 0, 2, 6, 9, 12 },
+                                                              { 0, 3, 6, 8 } });
+  const std::vector<std::vector<kahypar_hyperedge_id_t> > hyperedges(
+    { { 0, 2, 0, 1, 3, 4, 3, 4, 6, 2, 5, 6 },
+      { 0, 2, 0, 1, 3, 4, 3, 4, 6, 2, 5, 6 },
+      { 0, 1, 2, 3, 4, 5, 2, 3 } });
+
+  std::vector<const size_t*> hyperedge_index_ptrs;
+  std::vector<const kahypar_hyperedge_id_t*> hyperedge_ptrs;
+  std::vector<std::vector<kahypar_partition_id_t> > partitions;
+  std::vector<kahypar_partition_id_t*> partition_ptrs;
+  for (size_t i = 0; i < num_hypergraphs; ++i) {
+    hyperedge_index_ptrs.push_back(hyperedge_indices[i].data());
+    hyperedge_ptrs.push_back(hyperedges[i].data());
+    partitions.emplace_back(num_vertices[i], -1);
+  }
+  for (auto& partition : partitions) {
+    partition_ptrs.push_back(partition.data());
+  }
+
+  std::vector<kahypar_hyperedge_weight_t> objectives(num_hypergraphs, -1);
+  kahypar_partition_batch(num_hypergraphs, num_vertices.data(), num_hyperedges.data(),
+                          epsilons.data(), num_blocks.data(),
+                          /*vertex_weights */ nullptr, /*hyperedge_weights */ nullptr,
+                          hyperedge_index_ptrs.data(), hyperedge_ptrs.data(),
+                          /*num_threads */ 2, objectives.data(), context,
+                          partition_ptrs.data());
+
+  // each hypergraph is partitioned as if it was partitioned on its own
+  for (size_t i = 0; i < num_hypergraphs; ++i) {
+    kahypar_hyperedge_weight_t objective = 0;
+    std::vector<kahypar_partition_id_t> partition(num_vertices[i], -1);
+    kahypar_partition(num_vertices[i], num_hyperedges[i], epsilons[i], num_blocks[i],
+                      /*vertex_weights */ nullptr, /*hyperedge_weights */ nullptr,
+                      hyperedge_indices[i].data(), hyperedges[i].data(),
+                      &objective, context, partition.data());
+    ASSERT_EQ(objectives[i], objective);
+    ASSERT_THAT(partitions[i], ContainerEq(partition));
+  }
+
+  kahypar_context_free(context);
+}
+
 TEST(KaHyPar, CanImprovePartitionsViaInterface) {
   kahypar_context_t* context = kahypar_context_new();
 
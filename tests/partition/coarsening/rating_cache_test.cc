@@ -0,0 +1,94 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2019 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#include "gmock/gmock.h"
+
+#include "kahypar/definitions.h"
+#include "kahypar/partition/coarsening/rating_cache.h"
+
+using ::testing::Eq;
+using ::testing::Test;
+
+namespace kahypar {
+class ARatingCache : public Test {
+ public:
+  ARatingCache() :
+    hypergraph(7, 4, HyperedgeIndexVector { 0, 2, 6, 9,  /*sentinel*/ 12 },
+               HyperedgeVector { 0, 2, 0, 1, 3, 4, 3, 4, 6, 2, 5, 6 }, 2),
+    cache() {
+    for (const HypernodeID& hn : { 0, 1, 2, 3 }) {
+      hypergraph.setNodePart(hn, 0);
+    }
+    for (const HypernodeID& hn : { 4, 5, 6 }) {
+      hypergraph.setNodePart(hn, 1);
+    }
+    cache.prepare(hypergraph, 10);
+    for (const HypernodeID& hn : hypergraph.nodes()) {
+      cache.set(hn, hn, 1.0, true);
+    }
+  }
+
+  Hypergraph hypergraph;
+  RatingCache cache;
+};
+
+TEST_F(ARatingCache, IsEmptyForNewHypergraphs) {
+  RatingCache empty_cache;
+  empty_cache.prepare(hypergraph, 10);
+  for (const HypernodeID& hn : hypergraph.nodes()) {
+    ASSERT_THAT(empty_cache.contains(hn), Eq(false));
+  }
+}
+
+TEST_F(ARatingCache, KeepsRatingsIfPartitionDidNotChange) {
+  cache.prepare(hypergraph, 10);
+  for (const HypernodeID& hn : hypergraph.nodes()) {
+    ASSERT_THAT(cache.contains(hn), Eq(true));
+    ASSERT_THAT(cache.get(hn).target, Eq(hn));
+  }
+}
+
+TEST_F(ARatingCache, InvalidatesNeighborhoodOfMovedHypernodes) {
+  hypergraph.changeNodePart(6, 1, 0);
+  cache.prepare(hypergraph, 10);
+  ASSERT_THAT(cache.contains(0), Eq(true));
+  ASSERT_THAT(cache.contains(1), Eq(true));
+  for (const HypernodeID& hn : { 2, 3, 4, 5, 6 }) {
+    ASSERT_THAT(cache.contains(hn), Eq(false));
+  }
+}
+
+TEST_F(ARatingCache, InvalidatesNeighborhoodIfCommunitiesChange) {
+  hypergraph.setCommunities({ 0, 0, 0, 0, 0, 0, 1 });
+  cache.prepare(hypergraph, 10);
+  ASSERT_THAT(cache.contains(0), Eq(true));
+  ASSERT_THAT(cache.contains(1), Eq(true));
+  for (const HypernodeID& hn : { 2, 3, 4, 5, 6 }) {
+    ASSERT_THAT(cache.contains(hn), Eq(false));
+  }
+}
+
+TEST_F(ARatingCache, DropsAllRatingsIfThresholdNodeWeightChanges) {
+  cache.prepare(hypergraph, 20);
+  for (const HypernodeID& hn : hypergraph.nodes()) {
+    ASSERT_THAT(cache.contains(hn), Eq(false));
+  }
+}
+}  // namespace kahypar
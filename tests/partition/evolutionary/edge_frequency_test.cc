@@ -23,6 +23,7 @@
 #include "kahypar/partition/context_enum_classes.h"
 #include "kahypar/partition/evolutionary/edge_frequency.h"
 #include "kahypar/partition/evolutionary/individual.h"
+#include "kahypar/partition/evolutionary/population.h"
 #include "kahypar/utils/randomize.h"
 
 using ::testing::Eq;
@@ -72,4 +73,29 @@ TEST_F(TheEdgeFrequencyCalculation, IsSummarizingCorrectly) {
   ASSERT_EQ(results.at(3), 0);
   ASSERT_EQ(results.at(4), 2);
 }
+
+TEST_F(TheEdgeFrequencyCalculation, IsUpdatedIncrementallyWhenThePopulationChanges) {
+  context.partition.objective = Objective::km1;
+  auto makeIndividual = [&](const std::vector<PartitionID>& partition) {
+                          hypergraph.reset();
+                          for (HypernodeID hn = 0; hn < 8; ++hn) {
+                            hypergraph.setNodePart(hn, partition[hn]);
+                          }
+                          return Individual(hypergraph, context);
+                        };
+  Population population;
+  population.add(makeIndividual({ 0, 0, 1, 1, 0, 0, 1, 1 }));
+  population.add(makeIndividual({ 0, 0, 1, 0, 0, 0, 0, 0 }));
+  population.add(makeIndividual({ 0, 1, 1, 1, 0, 1, 1, 1 }));
+
+  EdgeFrequency frequency;
+  frequency.update(population.idsOfBest(2), population.listOfBest(2), 5, 2);
+  ASSERT_EQ(frequency.frequencies(), computeEdgeFrequency(population.listOfBest(2), 5));
+  ASSERT_EQ(frequency.numContributors(), 2);
+
+  population.forceInsert(makeIndividual({ 0, 0, 0, 0, 0, 0, 1, 1 }), population.best());
+  frequency.update(population.idsOfBest(2), population.listOfBest(2), 5, 2);
+  ASSERT_EQ(frequency.frequencies(), computeEdgeFrequency(population.listOfBest(2), 5));
+  ASSERT_EQ(frequency.numContributors(), 2);
+}
 }  // namespace kahypar
@@ -18,8 +18,16 @@
  * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
  *
 ******************************************************************************/
+#include <sys/stat.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
 #include <limits>
+#include <map>
+#include <memory>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "gmock/gmock.h"
@@ -118,4 +126,185 @@ TEST_F(TheEvoPartitioner, RespectsTheTimeLimit) {
   ASSERT_GT(total_time, context.partition.time_limit);
   ASSERT_LT(total_time - times.at(times.size() - 1), context.partition.time_limit);
 }
+
+TEST_F(TheEvoPartitioner, OnlyMeasuresTheEvolutionaryTimeOfItsOwnRun) {
+  // previous run
+  Timer::instance().add(context, Timepoint::evolutionary, 100.0);
+  EvoPartitioner evo_part(context);
+  ASSERT_DOUBLE_EQ(evo_part.evolutionaryTime(), 0.0);
+
+  // concurrent run in another thread
+  std::thread([&]() {
+      Timer::instance().add(context, Timepoint::evolutionary, 100.0);
+    }).join();
+  ASSERT_DOUBLE_EQ(evo_part.evolutionaryTime(), 0.0);
+
+  Timer::instance().add(context, Timepoint::evolutionary, 0.5);
+  ASSERT_DOUBLE_EQ(evo_part.evolutionaryTime(), 0.5);
+}
+
+TEST_F(TheEvoPartitioner, ExchangesIndividualsBetweenIslands) {
+  context.partition.quiet_mode = true;
+  context.evolutionary.dynamic_population_size = false;
+  context.evolutionary.population_size = 3;
+  context.evolutionary.num_migrants = 2;
+  std::unique_ptr<Hypergraph> other_hypergraph = ds::reindex(hypergraph).first;
+
+  EvoPartitioner sender(context);
+  EvoPartitioner receiver(context);
+  sender.generateInitialPopulation(hypergraph, context);
+  receiver.generateInitialPopulation(*other_hypergraph, context);
+
+  LocalMigration migration(2, context.evolutionary.num_migrants);
+  sender.migrate(hypergraph, context, migration, 0);
+  ASSERT_EQ(sender._population.size(), 3);
+
+  const std::vector<std::vector<PartitionID> > migrants = migration.receive(1);
+  ASSERT_EQ(migrants.size(), 2);
+  ASSERT_EQ(migrants[0], sender._population.individualAt(sender._population.best()).partition());
+
+  for (const std::vector<PartitionID>& partition : migrants) {
+    migration.send(0, std::vector<PartitionID>(partition));
+  }
+  receiver.migrate(*other_hypergraph, context, migration, 1);
+  ASSERT_EQ(receiver._population.size(), 3);
+  ASSERT_LE(receiver._population.bestFitness(), sender._population.bestFitness());
+  ASSERT_EQ(migration.receive(0).size(), 2);
+}
+
+TEST_F(TheEvoPartitioner, ExchangesIndividualsBetweenProcessesViaFiles) {
+  const std::string directory = "test_evo_partitioner_migration";
+  mkdir(directory.c_str(), 0755);
+  {
+    FileMigration first_process(directory, 0, 2, 1, 2, 6, 2);
+    FileMigration second_process(directory, 1, 2, 1, 2, 6, 2);
+    FileMigration other_k(directory, 1, 2, 1, 2, 6, 4);
+
+    first_process.send(0, { 0, 0, 0, 1, 1, 1 });
+    first_process.send(0, { 0, 1, 0, 1, 0, 1 });
+    first_process.send(0, { 1, 1, 0, 0, 1, 1 });
+    other_k.send(0, { 3, 3, 2, 2, 1, 0 });
+    ASSERT_TRUE(first_process.receive(0).empty());
+
+    const std::vector<std::vector<PartitionID> > migrants = second_process.receive(0);
+    ASSERT_EQ(migrants.size(), 2);
+    ASSERT_EQ(migrants[0], std::vector<PartitionID>({ 0, 1, 0, 1, 0, 1 }));
+    ASSERT_EQ(migrants[1], std::vector<PartitionID>({ 1, 1, 0, 0, 1, 1 }));
+    ASSERT_TRUE(second_process.receive(0).empty());
+
+    // not collected before the second process finishes
+    first_process.send(0, { 0, 0, 0, 1, 1, 1 });
+  }
+  // finished processes delete their inboxes and do not receive migrants anymore
+  ASSERT_FALSE(static_cast<bool>(std::ifstream(directory + "/island1.0.000000000003.part")));
+  {
+    FileMigration first_process(directory, 0, 2, 1, 2, 6, 2);
+    first_process.send(0, { 0, 0, 0, 1, 1, 1 });
+    ASSERT_FALSE(static_cast<bool>(std::ifstream(directory + "/island1.0.000000000000.part")));
+  }
+
+  // a single process whose only island sends its migrants to itself
+  context.partition.quiet_mode = true;
+  context.partition.time_limit = 1;
+  context.evolutionary.dynamic_population_size = false;
+  context.evolutionary.population_size = 3;
+  context.evolutionary.migration_interval = 1;
+  context.evolutionary.migration_directory = directory;
+  EvoPartitioner evo_part(context);
+  evo_part.partition(hypergraph, context);
+  ASSERT_EQ(metrics::hyperedgeCut(hypergraph), evo_part._population.bestFitness());
+
+  ASSERT_EQ(std::remove((directory + "/finished.0").c_str()), 0);
+  ASSERT_EQ(std::remove((directory + "/finished.1").c_str()), 0);
+  ASSERT_EQ(std::remove(directory.c_str()), 0);
+}
+
+TEST_F(TheEvoPartitioner, RunsMultipleIslandsInParallel) {
+  context.partition.quiet_mode = true;
+  context.partition.time_limit = 600;
+  context.evolutionary.dynamic_population_size = false;
+  context.evolutionary.population_size = 3;
+  context.evolutionary.num_islands = 3;
+  context.evolutionary.migration_interval = 1;
+
+  // Each island reports its progress after every iteration. The run is cancelled
+  // as soon as every island performed at least 10 iterations.
+  const size_t min_iterations = 10;
+  std::map<std::thread::id, size_t> iterations_per_thread;
+  context.partition.control = std::make_shared<PartitioningControl>();
+  context.partition.control->setCallback(
+    [&](const ProgressPhase phase, const HyperedgeWeight, const double) {
+      ASSERT_EQ(phase, ProgressPhase::evolutionary);
+      ++iterations_per_thread[std::this_thread::get_id()];
+      if (iterations_per_thread.size() == context.evolutionary.num_islands &&
+          std::all_of(iterations_per_thread.begin(), iterations_per_thread.end(),
+                      [&](const std::pair<const std::thread::id, size_t>& entry) {
+            return entry.second >= min_iterations;
+          })) {
+        context.partition.control->cancel();
+      }
+    });
+
+  EvoPartitioner evo_part(context);
+  evo_part.partition(hypergraph, context);
+
+  ASSERT_EQ(iterations_per_thread.size(), context.evolutionary.num_islands);
+  for (const auto& entry : iterations_per_thread) {
+    ASSERT_GE(entry.second, min_iterations);
+  }
+  ASSERT_GE(context.evolutionary.iteration, context.evolutionary.num_islands * min_iterations);
+  ASSERT_EQ(evo_part.bestPartition().size(), hypergraph.initialNumNodes());
+  for (const HypernodeID& hn : hypergraph.nodes()) {
+    ASSERT_EQ(hypergraph.partID(hn), evo_part.bestPartition()[hn]);
+  }
+  ASSERT_EQ(metrics::hyperedgeCut(hypergraph), evo_part._population.bestFitness());
+}
+
+TEST_F(TheEvoPartitioner, ContinuesFromACheckpoint) {
+  context.partition.quiet_mode = true;
+  context.partition.time_limit = 1;
+  context.evolutionary.dynamic_population_size = false;
+  context.evolutionary.population_size = 3;
+  context.evolutionary.checkpoint_filename = "test_evo_partitioner.checkpoint";
+  context.evolutionary.checkpoint_interval = 0;
+  Context resumed_context(context);
+
+  EvoPartitioner evo_part(context);
+  evo_part.partition(hypergraph, context);
+
+  resumed_context.evolutionary.resume = true;
+  EvoPartitioner resumed_evo_part(resumed_context);
+  const std::string random_state = Randomize::instance().state();
+  resumed_evo_part._checkpoint_filename = resumed_context.evolutionary.checkpoint_filename;
+  resumed_evo_part.resumeFromCheckpoint(hypergraph, resumed_context);
+
+  ASSERT_EQ(resumed_evo_part._population.size(), 3);
+  ASSERT_EQ(resumed_context.evolutionary.iteration, context.evolutionary.iteration);
+  ASSERT_GT(resumed_evo_part._time_offset, context.partition.time_limit);
+  for (size_t i = 0; i < 3; ++i) {
+    ASSERT_EQ(resumed_evo_part._population.individualAt(i).fitness(),
+              evo_part._population.individualAt(i).fitness());
+    ASSERT_EQ(resumed_evo_part._population.individualAt(i).partition(),
+              evo_part._population.individualAt(i).partition());
+    ASSERT_EQ(resumed_evo_part._population.individualAt(i).strongCutEdges(),
+              evo_part._population.individualAt(i).strongCutEdges());
+  }
+  ASSERT_EQ(Randomize::instance().state(), random_state);
+
+  // The time limit is already exceeded, so the resumed run only restores the best partition.
+  resumed_context.evolutionary.iteration = 0;
+  resumed_evo_part._population = Population();
+  resumed_evo_part.partition(hypergraph, resumed_context);
+  ASSERT_EQ(resumed_context.evolutionary.iteration, context.evolutionary.iteration);
+  ASSERT_EQ(resumed_evo_part.bestPartition(), evo_part.bestPartition());
+
+  Context other_context(resumed_context);
+  other_context.partition.k = 3;
+  Population population;
+  double elapsed_time = 0.0;
+  ASSERT_FALSE(EvoCheckpoint::read(context.evolutionary.checkpoint_filename, hypergraph,
+                                   other_context, population, elapsed_time));
+  ASSERT_EQ(population.size(), 0);
+  std::remove(context.evolutionary.checkpoint_filename.c_str());
+}
 }  // namespace kahypar
@@ -84,4 +84,27 @@ TEST_F(AnIndividual, IsCorrectlyExtractedFromTheHypergraphForCut) {
   ASSERT_EQ(individual.strongCutEdges()[2], 1);
   ASSERT_EQ(individual.fitness(), 2);
 }
+
+TEST_F(AnIndividual, ComputesTheDifferenceOfCutEdgesToAnotherIndividual) {
+  Context context;
+  context.partition.objective = Objective::km1;
+  hypergraph.setNodePart(0, 0);
+  hypergraph.setNodePart(1, 1);
+  hypergraph.setNodePart(2, 2);
+  hypergraph.setNodePart(3, 3);
+  const Individual first(hypergraph, context);
+  hypergraph.reset();
+  hypergraph.setNodePart(0, 0);
+  hypergraph.setNodePart(1, 0);
+  hypergraph.setNodePart(2, 1);
+  hypergraph.setNodePart(3, 1);
+  const Individual second(hypergraph, context);
+
+  ASSERT_EQ(second.cutEdges(), std::vector<HyperedgeID>({ 1 }));
+  ASSERT_EQ(first.difference(second, false), 1);
+  ASSERT_EQ(first.difference(second, true), 2);
+  ASSERT_EQ(second.difference(first, true), 2);
+  ASSERT_EQ(first.difference(first, true), 0);
+  ASSERT_EQ(second.partition(), std::vector<PartitionID>({ 0, 0, 1, 1 }));
+}
 }  // namespace kahypar
@@ -27,6 +27,7 @@
 #include "kahypar/datastructure/fast_reset_flag_array.h"
 #include "kahypar/datastructure/kway_priority_queue.h"
 #include "kahypar/definitions.h"
+#include "kahypar/partition/initial_partitioning/delta_gain_batch.h"
 #include "kahypar/partition/initial_partitioning/initial_partitioner_base.h"
 #include "kahypar/partition/initial_partitioning/policies/ip_gain_computation_policy.h"
 
@@ -123,6 +124,25 @@ TEST_F(AGainComputationPolicy, PerformsCorrectFMDeltaGainUpdates) {
   ASSERT_EQ(pq.key(6, 0), 0);
 }
 
+TEST_F(AGainComputationPolicy, PerformsCorrectBatchedFMDeltaGainUpdates) {
+  pushAllHypernodesIntoQueue<FMGainComputationPolicy>();
+  hypergraph.initializeNumCutHyperedges();
+  hypergraph.changeNodePart(3, 1, 0);
+  pq.remove(3, 0);
+  DeltaGainBatch<decltype(pq)> batch(pq, hypergraph.initialNumNodes(), 2);
+  FMGainComputationPolicy::deltaGainUpdate(hypergraph, context, batch, 3, 1, 0,
+                                           visit);
+  ASSERT_EQ(batch.key(4, 0), 1);
+  ASSERT_EQ(pq.key(4, 0), -1);
+  batch.flush();
+  ASSERT_EQ(pq.key(0, 1), -1);
+  ASSERT_EQ(pq.key(1, 1), 0);
+  ASSERT_EQ(pq.key(2, 1), 0);
+  ASSERT_EQ(pq.key(4, 0), 1);
+  ASSERT_EQ(pq.key(5, 0), 0);
+  ASSERT_EQ(pq.key(6, 0), 0);
+}
+
 TEST_F(AGainComputationPolicy, ComputesCorrectFMGainsAfterDeltaGainUpdateOnUnassignedPartMinusOne) {
   pushAllHypernodesIntoQueue<FMGainComputationPolicy>(false);
 
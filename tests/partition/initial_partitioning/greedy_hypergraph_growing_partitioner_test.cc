@@ -84,11 +84,12 @@ void generateRandomFixedVertices(Hypergraph& hypergraph,
 }
 
 template <typename StartNodeSelection, typename GainComputation,
-          typename QueueSelection>
+          typename QueueSelection, typename GainQueuePolicy = BinaryHeapGainQueue>
 struct GreedyTemplateStruct {
   typedef StartNodeSelection Type1;
   typedef GainComputation Type2;
   typedef QueueSelection Type3;
+  typedef GainQueuePolicy Type4;
 };
 
 template <class T>
@@ -117,12 +118,14 @@ class AKWayGreedyHypergraphGrowingPartitionerTest : public Test {
     initializeContext(*hypergraph, context, k);
 
     ghg = std::make_shared<GreedyHypergraphGrowingInitialPartitioner<typename T::Type1,
-                                                                     typename T::Type2, typename T::Type3> >
+                                                                     typename T::Type2, typename T::Type3,
+                                                                     typename T::Type4> >
             (*hypergraph, context);
   }
 
   std::shared_ptr<GreedyHypergraphGrowingInitialPartitioner<typename T::Type1,
-                                                            typename T::Type2, typename T::Type3> > ghg;
+                                                            typename T::Type2, typename T::Type3,
+                                                            typename T::Type4> > ghg;
   std::shared_ptr<Hypergraph> hypergraph;
   Context context;
 };
@@ -145,7 +148,19 @@ typedef ::testing::Types<
     GreedyTemplateStruct<BFSStartNodeSelectionPolicy<>,
                          MaxNetGainComputationPolicy, RoundRobinQueueSelectionPolicy>,
     GreedyTemplateStruct<BFSStartNodeSelectionPolicy<>,
-                         MaxNetGainComputationPolicy, SequentialQueueSelectionPolicy> > GreedyTestTemplates;
+                         MaxNetGainComputationPolicy, SequentialQueueSelectionPolicy>,
+    GreedyTemplateStruct<BFSStartNodeSelectionPolicy<>,
+                         FMGainComputationPolicy, GlobalQueueSelectionPolicy,
+                         IntegerBucketGainQueue>,
+    GreedyTemplateStruct<BFSStartNodeSelectionPolicy<>,
+                         FMGainComputationPolicy, SequentialQueueSelectionPolicy,
+                         IntegerBucketGainQueue>,
+    GreedyTemplateStruct<BFSStartNodeSelectionPolicy<>,
+                         MaxPinGainComputationPolicy, RoundRobinQueueSelectionPolicy,
+                         IntegerBucketGainQueue>,
+    GreedyTemplateStruct<BFSStartNodeSelectionPolicy<>,
+                         MaxNetGainComputationPolicy, GlobalQueueSelectionPolicy,
+                         IntegerBucketGainQueue> > GreedyTestTemplates;
 
 TYPED_TEST_CASE(AKWayGreedyHypergraphGrowingPartitionerTest,
                 GreedyTestTemplates);
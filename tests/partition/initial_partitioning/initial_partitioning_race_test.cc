@@ -0,0 +1,84 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2019 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#include "gmock/gmock.h"
+
+#include "kahypar/partition/initial_partitioning/initial_partitioning_race.h"
+
+using ::testing::Eq;
+using ::testing::Test;
+
+namespace kahypar {
+class AnInitialPartitioningRace : public Test {
+ public:
+  AnInitialPartitioningRace() :
+    race(0.5, 2) { }
+
+  InitialPartitioningRace race;
+};
+
+TEST_F(AnInitialPartitioningRace, DoesNotAbandonTrialsWithoutFeasibleResult) {
+  race.report(10, false);
+  ASSERT_THAT(race.isHopeless(1000), Eq(false));
+}
+
+TEST_F(AnInitialPartitioningRace, AbandonsTrialsThatAreWorseThanTheMargin) {
+  race.report(100, true);
+  race.report(120, true);
+  ASSERT_THAT(race.bestFeasibleQuality(), Eq(100));
+  ASSERT_THAT(race.isHopeless(150), Eq(false));
+  ASSERT_THAT(race.isHopeless(151), Eq(true));
+}
+
+TEST_F(AnInitialPartitioningRace, ForgetsTheBestResultOnReset) {
+  race.report(100, true);
+  race.reset();
+  ASSERT_THAT(race.isHopeless(1000), Eq(false));
+}
+
+TEST_F(AnInitialPartitioningRace, SkipsAlgorithmsThatKeepLosing) {
+  race.recordResult(InitialPartitionerAlgorithm::random, 151, true, 100, true);
+  ASSERT_THAT(race.shouldRun(InitialPartitionerAlgorithm::random), Eq(true));
+  race.recordResult(InitialPartitionerAlgorithm::random, 151, true, 100, true);
+  ASSERT_THAT(race.shouldRun(InitialPartitionerAlgorithm::random), Eq(false));
+  ASSERT_THAT(race.shouldRun(InitialPartitionerAlgorithm::bfs), Eq(true));
+}
+
+TEST_F(AnInitialPartitioningRace, ReevaluatesSkippedAlgorithms) {
+  race.recordResult(InitialPartitionerAlgorithm::random, 151, true, 100, true);
+  race.recordResult(InitialPartitionerAlgorithm::random, 151, true, 100, true);
+  ASSERT_THAT(race.shouldRun(InitialPartitionerAlgorithm::random), Eq(false));
+  ASSERT_THAT(race.shouldRun(InitialPartitionerAlgorithm::random), Eq(true));
+  race.recordResult(InitialPartitionerAlgorithm::random, 100, true, 100, true);
+  ASSERT_THAT(race.shouldRun(InitialPartitionerAlgorithm::random), Eq(true));
+}
+
+TEST_F(AnInitialPartitioningRace, DoesNotCountResultsWithinTheMarginAsLosses) {
+  race.recordResult(InitialPartitionerAlgorithm::random, 150, true, 100, true);
+  race.recordResult(InitialPartitionerAlgorithm::random, 150, true, 100, true);
+  ASSERT_THAT(race.shouldRun(InitialPartitionerAlgorithm::random), Eq(true));
+}
+
+TEST_F(AnInitialPartitioningRace, CountsInfeasibleResultsAsLossesAgainstAFeasibleBest) {
+  race.recordResult(InitialPartitionerAlgorithm::random, 50, false, 100, true);
+  race.recordResult(InitialPartitionerAlgorithm::random, 50, false, 100, true);
+  ASSERT_THAT(race.shouldRun(InitialPartitionerAlgorithm::random), Eq(false));
+}
+}  // namespace kahypar
@@ -0,0 +1,113 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2019 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#include <memory>
+#include <vector>
+
+#include "gmock/gmock.h"
+
+#include "kahypar/io/hypergraph_io.h"
+#include "kahypar/partition/metrics.h"
+#include "kahypar/partition/registries/register_initial_partitioning_algorithms.h"
+#include "kahypar/utils/randomize.h"
+
+using ::testing::Eq;
+using ::testing::ElementsAreArray;
+using ::testing::Test;
+
+namespace kahypar {
+class AParallelInitialPartitioner : public Test {
+ public:
+  AParallelInitialPartitioner() :
+    hypergraph(io::createHypergraphFromFile(
+                 "test_instances/test_instance.hgr", 4)),
+    context() {
+    context.partition.k = 4;
+    context.partition.epsilon = 0.05;
+    context.partition.objective = Objective::km1;
+    context.initial_partitioning.k = 4;
+    context.initial_partitioning.refinement = false;
+    context.initial_partitioning.nruns = 5;
+    context.initial_partitioning.num_threads = 2;
+    context.initial_partitioning.unassigned_part = -1;
+    context.initial_partitioning.lp_max_iteration = 100;
+    context.initial_partitioning.lp_assign_vertex_to_part = 5;
+    const HypernodeWeight perfect_weight = ceil(hypergraph.totalWeight() / 4.0);
+    for (PartitionID i = 0; i < context.partition.k; ++i) {
+      context.initial_partitioning.perfect_balance_partition_weight.push_back(perfect_weight);
+      context.initial_partitioning.upper_allowed_partition_weight.push_back(
+        perfect_weight * (1.0 + context.partition.epsilon));
+      context.partition.perfect_balance_part_weights.push_back(perfect_weight);
+      context.partition.max_part_weights.push_back(
+        context.initial_partitioning.upper_allowed_partition_weight.back());
+    }
+  }
+
+  std::vector<PartitionID> partition(const InitialPartitionerAlgorithm algo,
+                                     const size_t num_threads) {
+    Randomize::instance().setSeed(42);
+    hypergraph.resetPartitioning();
+    Context ip_context(context);
+    ip_context.initial_partitioning.algo = algo;
+    ip_context.initial_partitioning.num_threads = num_threads;
+    std::unique_ptr<IInitialPartitioner> partitioner(
+      InitialPartitioningFactory::getInstance().createObject(algo, hypergraph, ip_context));
+    partitioner->partition();
+    std::vector<PartitionID> partition;
+    for (const HypernodeID& hn : hypergraph.nodes()) {
+      partition.push_back(hypergraph.partID(hn));
+    }
+    return partition;
+  }
+
+  Hypergraph hypergraph;
+  Context context;
+};
+
+TEST_F(AParallelInitialPartitioner, AssignsAllHypernodesWithMultipleRuns) {
+  partition(InitialPartitionerAlgorithm::greedy_global, 2);
+  for (const HypernodeID& hn : hypergraph.nodes()) {
+    ASSERT_THAT(hypergraph.partID(hn) >= 0 && hypergraph.partID(hn) < 4, Eq(true));
+  }
+}
+
+TEST_F(AParallelInitialPartitioner, AssignsAllHypernodesWithThePool) {
+  partition(InitialPartitionerAlgorithm::pool, 3);
+  for (const HypernodeID& hn : hypergraph.nodes()) {
+    ASSERT_THAT(hypergraph.partID(hn) >= 0 && hypergraph.partID(hn) < 4, Eq(true));
+  }
+}
+
+TEST_F(AParallelInitialPartitioner, AssignsAllHypernodesInRacingMode) {
+  context.initial_partitioning.race = std::make_shared<InitialPartitioningRace>(0.0, 1);
+  for (const size_t num_threads : { 1, 2 }) {
+    partition(InitialPartitionerAlgorithm::pool, num_threads);
+    for (const HypernodeID& hn : hypergraph.nodes()) {
+      ASSERT_THAT(hypergraph.partID(hn) >= 0 && hypergraph.partID(hn) < 4, Eq(true));
+    }
+  }
+}
+
+TEST_F(AParallelInitialPartitioner, ComputesTheSameResultIndependentOfTheNumberOfThreads) {
+  const std::vector<PartitionID> two_threads = partition(InitialPartitionerAlgorithm::pool, 2);
+  const std::vector<PartitionID> four_threads = partition(InitialPartitionerAlgorithm::pool, 4);
+  ASSERT_THAT(four_threads, ElementsAreArray(two_threads));
+}
+}  // namespace kahypar
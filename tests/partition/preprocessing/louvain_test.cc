@@ -173,6 +173,49 @@ TEST_F(ALouvainAlgorithm, AssingsMappingToNextLevelFinerGraph) {
   ASSERT_EQ(2, graph.clusterID(10));
 }
 
+class AParallelLouvainAlgorithm : public ALouvainAlgorithm {
+ public:
+  AParallelLouvainAlgorithm() :
+    ALouvainAlgorithm() {
+    context.preprocessing.community_detection.num_threads = 4;
+  }
+};
+
+TEST_F(AParallelLouvainAlgorithm, DoesOneLouvainPass) {
+  Graph graph(hypergraph, context);
+  Modularity modularity(graph);
+  EdgeWeight quality_before = modularity.quality();
+  EdgeWeight quality_after = louvain->parallel_louvain_pass(graph, modularity);
+  ASSERT_LE(quality_before, quality_after);
+}
+
+TEST_F(AParallelLouvainAlgorithm, ContractsClustersLikeSequentialContraction) {
+  Graph graph(hypergraph, context);
+  Modularity modularity(graph);
+  louvain->parallel_louvain_pass(graph, modularity);
+  Graph other_graph(hypergraph, context);
+  for (const NodeID& node : graph.nodes()) {
+    other_graph.setClusterID(node, graph.clusterID(node));
+  }
+
+  auto parallel_contraction = graph.contractClusters(4);
+  auto sequential_contraction = other_graph.contractClusters();
+  ASSERT_EQ(parallel_contraction.second, sequential_contraction.second);
+  const Graph& parallel_graph = parallel_contraction.first;
+  const Graph& sequential_graph = sequential_contraction.first;
+  ASSERT_EQ(parallel_graph.numNodes(), sequential_graph.numNodes());
+  ASSERT_EQ(parallel_graph.numEdges(), sequential_graph.numEdges());
+  for (const NodeID& node : parallel_graph.nodes()) {
+    ASSERT_EQ(parallel_graph.degree(node), sequential_graph.degree(node));
+    auto it = sequential_graph.firstEdge(node);
+    for (const ds::Edge& e : parallel_graph.incidentEdges(node)) {
+      ASSERT_EQ(e.target_node, it->target_node);
+      ASSERT_LE(std::abs(e.weight - it->weight), Graph::kEpsilon);
+      ++it;
+    }
+  }
+}
+
 namespace  ds {
 TEST(ALouvainKarateClub, DoesLouvainAlgorithm) {
   std::string karate_club_file = "test_instances/karate_club.internal_graph";
@@ -216,6 +259,27 @@ TEST(ALouvainKarateClub, DoesLouvainAlgorithm) {
   }
 }
 
+TEST(AParallelLouvain, FindsCommunitiesOfKarateClub) {
+  Context context;
+  context.partition.k = 2;
+  context.partition.graph_filename = "test_instances/karate_club.graph.hgr";
+  context.preprocessing.community_detection.max_pass_iterations = 100;
+  context.preprocessing.community_detection.min_eps_improvement = 0.0001;
+  context.preprocessing.community_detection.edge_weight = LouvainEdgeWeight::uniform;
+  context.preprocessing.community_detection.num_threads = 4;
+
+  Hypergraph hypergraph(
+    io::createHypergraphFromFile(context.partition.graph_filename,
+                                 context.partition.k));
+
+  Louvain<Modularity, false> louvain(hypergraph, context);
+  const EdgeWeight quality = louvain.run();
+
+  // best known modularity of the karate club network is 0.4198
+  ASSERT_GE(quality, 0.39L);
+  ASSERT_GE(louvain.numCommunities(), 3u);
+}
+
 TEST(Louvain, WorksOnGraphDSThatChangesHypergraphIntoGraph) {
   Context context;
 
@@ -241,5 +305,64 @@ TEST(Louvain, WorksOnGraphDSThatChangesHypergraphIntoGraph) {
     ASSERT_EQ(louvain.clusterID(node), expected_comm[node]);
   }
 }
+
+template <typename GraphType>
+void findsKarateClubCommunitiesUsingGraph() {
+  Context context;
+  context.partition.k = 2;
+  context.partition.graph_filename = "test_instances/karate_club.graph.hgr";
+  context.preprocessing.community_detection.max_pass_iterations = 100;
+  context.preprocessing.community_detection.min_eps_improvement = 0.0001;
+  context.preprocessing.community_detection.edge_weight = LouvainEdgeWeight::uniform;
+
+  Hypergraph hypergraph(
+    io::createHypergraphFromFile(context.partition.graph_filename,
+                                 context.partition.k));
+
+  Louvain<ModularityT<GraphType>, false> louvain(hypergraph, context);
+
+  louvain.run();
+
+  std::vector<ClusterID> expected_comm = { 0, 0, 0, 0, 1, 1, 1, 0, 2, 0, 1, 0, 0, 0, 2, 2, 1, 0,
+                                           2, 0, 2, 0, 2, 3, 3, 3, 2, 3, 3, 2, 2, 3, 2, 2 };
+  for (const NodeID& node : hypergraph.nodes()) {
+    ASSERT_EQ(louvain.clusterID(node), expected_comm[node]);
+  }
+}
+
+TEST(Louvain, WorksWithDoublePrecisionEdgeWeights) {
+  findsKarateClubCommunitiesUsingGraph<DoubleWeightGraph>();
+}
+
+TEST(Louvain, WorksWithSinglePrecisionEdgeWeights) {
+  findsKarateClubCommunitiesUsingGraph<FloatWeightGraph>();
+}
+
+TEST(AGraph, StoresCompactEdgesForReducedEdgeWeightPrecision) {
+  ASSERT_EQ(sizeof(EdgeT<double>), 16);
+  ASSERT_EQ(sizeof(EdgeT<float>), 8);
+}
+
+template <typename GraphType>
+size_t communityDetectionMemory(const Hypergraph& hypergraph, const Context& context) {
+  GraphType graph(hypergraph, context);
+  ModularityT<GraphType> modularity(graph);
+  // grows the incident cluster weight buffer to its maximum size
+  for (const NodeID& node : graph.nodes()) {
+    graph.incidentClusterWeightOfNode(node);
+  }
+  return graph.sizeInBytes() + modularity.sizeInBytes();
+}
+
+TEST(AGraph, NeedsLessThanHalfTheMemoryWithSinglePrecisionEdgeWeights) {
+  Context context;
+  context.partition.k = 2;
+  context.preprocessing.community_detection.edge_weight = LouvainEdgeWeight::degree;
+  Hypergraph hypergraph(io::createHypergraphFromFile("../../end_to_end/test_instances/ISPD98_ibm01.hgr", 2));
+
+  const size_t long_double_bytes = communityDetectionMemory<Graph>(hypergraph, context);
+  const size_t float_bytes = communityDetectionMemory<FloatWeightGraph>(hypergraph, context);
+  ASSERT_LT(2 * float_bytes, long_double_bytes);
+}
 }  // namespace ds
 }  // namespace kahypar
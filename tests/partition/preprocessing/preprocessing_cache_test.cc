@@ -0,0 +1,128 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2019 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "gmock/gmock.h"
+
+#include "kahypar/definitions.h"
+#include "kahypar/io/hypergraph_io.h"
+#include "kahypar/partition/preprocessing/hypergraph_deduplicator.h"
+#include "kahypar/partition/preprocessing/preprocessing_cache.h"
+
+using ::testing::ElementsAreArray;
+using ::testing::Eq;
+using ::testing::Test;
+
+namespace kahypar {
+class APreprocessingCache : public Test {
+ public:
+  APreprocessingCache() :
+    context(),
+    hypergraph(io::createHypergraphFromFile(
+                 "test_instances/WeightedHypergraph.hgr", 2)),
+    cache_file("test_instances/WeightedHypergraph.hgr.cache") {
+    context.partition.graph_filename = "test_instances/WeightedHypergraph.hgr";
+    context.partition.mode = Mode::direct_kway;
+    context.preprocessing.enable_deduplication = true;
+    context.preprocessing.enable_community_detection = true;
+    context.preprocessing.community_detection.edge_weight = LouvainEdgeWeight::uniform;
+    std::remove(cache_file.c_str());
+  }
+
+  ~APreprocessingCache() override {
+    std::remove(cache_file.c_str());
+  }
+
+  Context context;
+  Hypergraph hypergraph;
+  std::string cache_file;
+};
+
+TEST_F(APreprocessingCache, CanBeReadAfterItWasWritten) {
+  PreprocessingCache cache;
+  cache.identicalNodes() = { { 0, 3 } };
+  cache.parallelHyperedges() = { { 2, 1 } };
+  cache.communities().assign(hypergraph.initialNumNodes(), 1);
+  const uint64_t key = PreprocessingCache::computeKey(context);
+  cache.write(cache_file, key, hypergraph);
+
+  PreprocessingCache read_cache;
+  ASSERT_THAT(read_cache.read(cache_file, key, hypergraph), Eq(true));
+  ASSERT_THAT(read_cache.identicalNodes(), ElementsAreArray(cache.identicalNodes()));
+  ASSERT_THAT(read_cache.parallelHyperedges(), ElementsAreArray(cache.parallelHyperedges()));
+  ASSERT_THAT(read_cache.communities(), ElementsAreArray(cache.communities()));
+}
+
+TEST_F(APreprocessingCache, IsNotReadIfPreprocessingParametersDiffer) {
+  PreprocessingCache cache;
+  cache.communities().assign(hypergraph.initialNumNodes(), 1);
+  cache.write(cache_file, PreprocessingCache::computeKey(context), hypergraph);
+
+  context.preprocessing.community_detection.edge_weight = LouvainEdgeWeight::degree;
+  PreprocessingCache read_cache;
+  ASSERT_THAT(read_cache.read(cache_file, PreprocessingCache::computeKey(context), hypergraph),
+              Eq(false));
+}
+
+TEST_F(APreprocessingCache, IsNotReadIfItDoesNotExist) {
+  PreprocessingCache cache;
+  ASSERT_THAT(cache.read(cache_file, PreprocessingCache::computeKey(context), hypergraph),
+              Eq(false));
+}
+
+TEST(TheHypergraphDeduplicator, ReplaysCachedDeduplication) {
+  Hypergraph hypergraph(5, 7, HyperedgeIndexVector { 0, 1, 4, 6, 10, 13, 14, 17 },
+                        HyperedgeVector { 0, 1, 2, 3, 0, 1, 1, 2, 3, 4, 1, 2, 3, 0, 1, 2, 3 });
+  Hypergraph replayed_hypergraph(5, 7, HyperedgeIndexVector { 0, 1, 4, 6, 10, 13, 14, 17 },
+                                 HyperedgeVector { 0, 1, 2, 3, 0, 1, 1, 2, 3, 4, 1, 2, 3, 0, 1,
+                                                   2, 3 });
+  Context context;
+  HypergraphDeduplicator deduplicator;
+  deduplicator.deduplicate(hypergraph, context);
+
+  std::vector<PreprocessingCache::NodePair> identical_nodes;
+  for (const auto& memento : deduplicator.removedIdenticalVertices()) {
+    identical_nodes.emplace_back(memento.u, memento.v);
+  }
+  HypergraphDeduplicator replaying_deduplicator;
+  replaying_deduplicator.replay(replayed_hypergraph, context, identical_nodes,
+                                deduplicator.removedParallelHyperedges());
+
+  ASSERT_THAT(replayed_hypergraph.currentNumNodes(), Eq(hypergraph.currentNumNodes()));
+  ASSERT_THAT(replayed_hypergraph.currentNumEdges(), Eq(hypergraph.currentNumEdges()));
+  for (const HyperedgeID& he : hypergraph.edges()) {
+    ASSERT_THAT(replayed_hypergraph.edgeWeight(he), Eq(hypergraph.edgeWeight(he)));
+  }
+  for (const HypernodeID& hn : hypergraph.nodes()) {
+    ASSERT_THAT(replayed_hypergraph.nodeWeight(hn), Eq(hypergraph.nodeWeight(hn)));
+  }
+
+  for (const HypernodeID& hn : replayed_hypergraph.nodes()) {
+    replayed_hypergraph.setNodePart(hn, hn % 2);
+  }
+  replayed_hypergraph.initializeNumCutHyperedges();
+  replaying_deduplicator.restoreRedundancy(replayed_hypergraph);
+  ASSERT_THAT(replayed_hypergraph.currentNumNodes(), Eq(5u));
+  ASSERT_THAT(replayed_hypergraph.currentNumEdges(), Eq(7u));
+}
+}  // namespace kahypar
@@ -0,0 +1,143 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2019 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#include "gmock/gmock.h"
+
+#include <memory>
+
+#include "kahypar/definitions.h"
+#include "kahypar/partition/context.h"
+#include "kahypar/partition/time_budget.h"
+
+using ::testing::Test;
+using ::testing::Eq;
+using ::testing::DoubleEq;
+using ::testing::Le;
+using ::testing::Lt;
+using ::testing::Gt;
+
+namespace kahypar {
+class ATimeBudget : public Test {
+ public:
+  ATimeBudget() :
+    hypergraph(7, 4, HyperedgeIndexVector { 0, 2, 6, 9,  /*sentinel*/ 12 },
+               HyperedgeVector { 0, 2, 0, 1, 3, 4, 3, 4, 6, 2, 5, 6 }),
+    context() {
+    context.partition.k = 2;
+    context.initial_partitioning.algo = InitialPartitionerAlgorithm::pool;
+    context.initial_partitioning.nruns = 20;
+    context.local_search.algorithm = RefinementAlgorithm::twoway_fm;
+    context.local_search.fm.max_number_of_fruitless_moves = 350;
+    context.local_search.fm.adaptive_stopping_alpha = 1.0;
+    context.local_search.flow.alpha = 16.0;
+  }
+
+  std::unique_ptr<TimeBudget> budget(const double seconds) {
+    return std::make_unique<TimeBudget>(seconds, context);
+  }
+
+  Hypergraph hypergraph;
+  Context context;
+};
+
+TEST_F(ATimeBudget, IsOnlyActiveForTheTopLevelPartitioner) {
+  ASSERT_FALSE(TimeBudget::isActive(context));
+  context.partition.time_budget = std::make_shared<TimeBudget>(1.0, context);
+  ASSERT_TRUE(TimeBudget::isActive(context));
+
+  Context initial_partitioning_context(context);
+  initial_partitioning_context.type = ContextType::initial_partitioning;
+  ASSERT_FALSE(TimeBudget::isActive(initial_partitioning_context));
+}
+
+TEST_F(ATimeBudget, AssignsTheGivenShareOfTheRemainingTimeToACycle) {
+  auto time_budget = budget(100.0);
+  time_budget->startCycle(0.25);
+  ASSERT_THAT(time_budget->remainingTime(), Le(25.0));
+  ASSERT_THAT(time_budget->remainingTime(), Gt(24.0));
+}
+
+TEST_F(ATimeBudget, KeepsTheInitialPartitioningConfigurationIfItFitsIntoTheBudget) {
+  auto time_budget = budget(1000.0);
+  time_budget->recordCoarsening(0.1, hypergraph.currentNumPins());
+  Context init_context(context);
+  time_budget->adaptInitialPartitioning(hypergraph, init_context, context);
+  ASSERT_THAT(init_context.initial_partitioning.nruns, Eq(20));
+  ASSERT_THAT(init_context.local_search.fm.max_number_of_fruitless_moves, Eq(350));
+}
+
+TEST_F(ATimeBudget, ReducesTheNumberOfInitialPartitioningRunsIfTheyDoNotFitIntoTheBudget) {
+  auto time_budget = budget(2.0);
+  // Coarsening the hypergraph once takes 0.1s. Initial partitioning therefore takes
+  // 0.4s + 20 * 9 * 0.006s = 1.48s and local search takes 1s, i.e. initial partitioning
+  // gets 1.48/2.48 of the remaining 2s which suffices for 14 runs.
+  time_budget->recordCoarsening(0.1, hypergraph.currentNumPins());
+  Context init_context(context);
+  time_budget->adaptInitialPartitioning(hypergraph, init_context, context);
+  ASSERT_THAT(init_context.initial_partitioning.nruns, Eq(14));
+  ASSERT_THAT(init_context.local_search.fm.max_number_of_fruitless_moves, Eq(350));
+}
+
+TEST_F(ATimeBudget, ReducesTheEffortOfASingleInitialPartitioningRunIfItDoesNotFitIntoTheBudget) {
+  context.preprocessing.enable_community_detection = true;
+  auto time_budget = budget(1.0);
+  time_budget->recordCoarsening(10.0, hypergraph.currentNumPins());
+  Context init_context(context);
+  time_budget->adaptInitialPartitioning(hypergraph, init_context, context);
+  ASSERT_THAT(init_context.initial_partitioning.nruns, Eq(1));
+  ASSERT_FALSE(init_context.preprocessing.enable_community_detection);
+  ASSERT_THAT(init_context.local_search.fm.max_number_of_fruitless_moves, Lt(350));
+}
+
+TEST_F(ATimeBudget, ScalesDownLocalSearchParametersAndRestoresThem) {
+  context.local_search.algorithm = RefinementAlgorithm::kway_fm_flow_km1;
+  auto time_budget = budget(1.0);
+  // The estimated local search time is 40 * 0.05s = 2s.
+  time_budget->recordCoarsening(0.05, hypergraph.currentNumPins());
+  time_budget->adaptLocalSearch(context);
+  ASSERT_THAT(context.local_search.fm.max_number_of_fruitless_moves, Le(175));
+  ASSERT_THAT(context.local_search.fm.max_number_of_fruitless_moves, Gt(150));
+  ASSERT_THAT(context.local_search.fm.adaptive_stopping_alpha, Le(0.5));
+  ASSERT_THAT(context.local_search.flow.alpha, Le(8.0));
+  ASSERT_THAT(context.local_search.flow.alpha, Gt(7.0));
+
+  time_budget->restoreLocalSearch(context);
+  ASSERT_THAT(context.local_search.fm.max_number_of_fruitless_moves, Eq(350));
+  ASSERT_THAT(context.local_search.fm.adaptive_stopping_alpha, DoubleEq(1.0));
+  ASSERT_THAT(context.local_search.flow.alpha, DoubleEq(16.0));
+}
+
+TEST_F(ATimeBudget, DoesNotChangeLocalSearchParametersIfTheyFitIntoTheBudget) {
+  auto time_budget = budget(1000.0);
+  time_budget->recordCoarsening(0.05, hypergraph.currentNumPins());
+  time_budget->adaptLocalSearch(context);
+  ASSERT_THAT(context.local_search.fm.max_number_of_fruitless_moves, Eq(350));
+  ASSERT_THAT(context.local_search.flow.alpha, DoubleEq(16.0));
+}
+
+TEST_F(ATimeBudget, OnlyAllowsVCyclesThatFitIntoTheRemainingTime) {
+  auto time_budget = budget(1.0);
+  time_budget->recordCoarsening(0.1, hypergraph.currentNumPins());
+  time_budget->recordLocalSearch(0.2);
+  ASSERT_TRUE(time_budget->allowsVCycle());
+  time_budget->recordLocalSearch(5.0);
+  ASSERT_FALSE(time_budget->allowsVCycle());
+}
+}  // namespace kahypar
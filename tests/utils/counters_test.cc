@@ -0,0 +1,68 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2016 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+******************************************************************************/
+
+#include "gmock/gmock.h"
+
+#include <thread>
+#include <vector>
+
+#include "kahypar/utils/counters.h"
+
+using ::testing::Eq;
+
+namespace kahypar {
+class ACounters : public ::testing::Test {
+ public:
+  ACounters() {
+    Counters::instance().reset();
+  }
+};
+
+TEST_F(ACounters, AccumulatesIncrements) {
+  Counters::add(Counter::fm_moves, 3);
+  Counters::add(Counter::fm_moves, 4);
+  Counters::add(Counter::pq_operations, 1);
+  ASSERT_THAT(Counters::instance().total(Counter::fm_moves), Eq(7));
+  ASSERT_THAT(Counters::instance().total(Counter::pq_operations), Eq(1));
+  ASSERT_THAT(Counters::instance().total(Counter::rating_calls), Eq(0));
+}
+
+TEST_F(ACounters, SumsUpTheCountsOfAllThreads) {
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 4; ++i) {
+    threads.emplace_back([]() {
+        for (int j = 0; j < 1000; ++j) {
+          Counters::add(Counter::pins_visited, 2);
+        }
+      });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+  Counters::add(Counter::pins_visited, 1);
+  ASSERT_THAT(Counters::instance().total(Counter::pins_visited), Eq(8001));
+}
+
+TEST_F(ACounters, CanBeReset) {
+  Counters::add(Counter::flow_augmentations, 5);
+  Counters::instance().reset();
+  ASSERT_THAT(Counters::instance().total(Counter::flow_augmentations), Eq(0));
+}
+}  // namespace kahypar
@@ -0,0 +1,64 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2016 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+******************************************************************************/
+
+#include "gmock/gmock.h"
+
+#include <vector>
+
+#include "kahypar/utils/memory_tracker.h"
+
+using ::testing::Eq;
+using ::testing::Gt;
+
+namespace kahypar {
+class AMemoryTracker : public ::testing::Test {
+ public:
+  AMemoryTracker() {
+    MemoryTracker::instance().clear();
+  }
+};
+
+TEST_F(AMemoryTracker, KeepsTheLargestReportedSizeOfEachComponent) {
+  MemoryTracker::instance().report(MemoryComponent::gain_cache, 100);
+  MemoryTracker::instance().report(MemoryComponent::gain_cache, 300);
+  MemoryTracker::instance().report(MemoryComponent::gain_cache, 200);
+  MemoryTracker::instance().report(MemoryComponent::flow_network, 42);
+
+  const MemoryTracker::Sizes sizes = MemoryTracker::instance().peakSizes();
+  ASSERT_THAT(sizes[static_cast<size_t>(MemoryComponent::gain_cache)], Eq(300));
+  ASSERT_THAT(sizes[static_cast<size_t>(MemoryComponent::flow_network)], Eq(42));
+  ASSERT_THAT(sizes[static_cast<size_t>(MemoryComponent::hypergraph)], Eq(0));
+}
+
+TEST_F(AMemoryTracker, CanBeCleared) {
+  MemoryTracker::instance().report(MemoryComponent::population, 100);
+  MemoryTracker::instance().clear();
+  ASSERT_THAT(MemoryTracker::instance().peakSizes()[static_cast<size_t>(MemoryComponent::population)],
+              Eq(0));
+}
+
+TEST(PeakRSS, GrowsWithAllocatedMemory) {
+  const size_t before = MemoryTracker::peakRSS();
+  std::vector<char> memory(64 * 1024 * 1024, 1);
+  ASSERT_THAT(before, Gt(0));
+  ASSERT_THAT(MemoryTracker::peakRSS(), Gt(before));
+  ASSERT_THAT(memory[memory.size() / 2], Eq(1));
+}
+}  // namespace kahypar
@@ -0,0 +1,78 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2019 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#include "gmock/gmock.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "kahypar/utils/parallel.h"
+
+using ::testing::Eq;
+
+namespace kahypar {
+namespace parallel {
+TEST(AThreadPool, ProcessesEachElementExactlyOnceInEachCall) {
+  ThreadPool pool(4);
+  std::vector<std::atomic<size_t> > visits(1000);
+  for (std::atomic<size_t>& visit : visits) {
+    visit.store(0);
+  }
+
+  for (size_t round = 0; round < 100; ++round) {
+    pool.forEachChunk(visits.size(), [&](const size_t thread, const size_t begin,
+                                         const size_t end) {
+        ASSERT_LT(thread, pool.numThreads());
+        for (size_t i = begin; i < end; ++i) {
+          ++visits[i];
+        }
+      });
+  }
+
+  for (const std::atomic<size_t>& visit : visits) {
+    ASSERT_THAT(visit.load(), Eq(100));
+  }
+}
+
+TEST(AThreadPool, ReusesItsThreads) {
+  ThreadPool pool(3);
+  std::vector<std::thread::id> first_ids(3);
+  pool.forEachChunk(3, [&](const size_t thread, const size_t, const size_t) {
+      first_ids[thread] = std::this_thread::get_id();
+    });
+  pool.forEachChunk(3, [&](const size_t thread, const size_t, const size_t) {
+      ASSERT_THAT(std::this_thread::get_id(), Eq(first_ids[thread]));
+    });
+  ASSERT_THAT(first_ids[0], Eq(std::this_thread::get_id()));
+}
+
+TEST(AThreadPool, UsesOnlyTheCallingThreadForSmallRanges) {
+  ThreadPool pool(4);
+  size_t calls = 0;
+  pool.forEachChunk(1, [&](const size_t thread, const size_t begin, const size_t end) {
+      ASSERT_THAT(thread, Eq(0));
+      ASSERT_THAT(end - begin, Eq(1));
+      ++calls;
+    });
+  ASSERT_THAT(calls, Eq(1));
+}
+}  // namespace parallel
+}  // namespace kahypar
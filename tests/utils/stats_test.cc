@@ -0,0 +1,56 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2019 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#include "gmock/gmock.h"
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "kahypar/partition/context.h"
+#include "kahypar/utils/stats.h"
+
+using ::testing::Eq;
+
+namespace kahypar {
+TEST(AStats, CollectsTheStatsOfContextsDestroyedConcurrently) {
+  Context context;
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < 4; ++i) {
+    threads.emplace_back([&]() {
+        for (size_t j = 0; j < 100; ++j) {
+          Context copy(context);
+          copy.stats.set(StatTag::Coarsening, "contraction", 1);
+        }
+      });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+
+  const std::string stats = context.stats.serialize().str();
+  size_t occurrences = 0;
+  for (size_t pos = stats.find("contraction=1"); pos != std::string::npos;
+       pos = stats.find("contraction=1", pos + 1)) {
+    ++occurrences;
+  }
+  ASSERT_THAT(occurrences, Eq(400));
+}
+}  // namespace kahypar
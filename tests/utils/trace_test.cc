@@ -0,0 +1,127 @@
+/*******************************************************************************
+ * This file is part of KaHyPar.
+ *
+ * Copyright (C) 2019 Sebastian Schlag <sebastian.schlag@kit.edu>
+ *
+ * KaHyPar is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * KaHyPar is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with KaHyPar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ******************************************************************************/
+
+#include "gmock/gmock.h"
+
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "kahypar/utils/trace.h"
+
+using ::testing::Eq;
+using ::testing::HasSubstr;
+using ::testing::Le;
+using ::testing::Ne;
+
+namespace kahypar {
+class ATraceRecorder : public ::testing::Test {
+ public:
+  ATraceRecorder() :
+    recorder(std::make_shared<TraceRecorder>()) { }
+
+  std::shared_ptr<TraceRecorder> recorder;
+};
+
+TEST_F(ATraceRecorder, IgnoresSpansWithoutRecorder) {
+  {
+    TraceSpan span(nullptr, "ignored", "test");
+    span.arg("pass", 3);
+  }
+  ASSERT_THAT(recorder->events().size(), Eq(0));
+}
+
+TEST_F(ATraceRecorder, OnlyRecordsItsOwnSpans) {
+  const std::shared_ptr<TraceRecorder> other_recorder = std::make_shared<TraceRecorder>();
+  {
+    TraceSpan span(recorder, "own", "test");
+    TraceSpan other_span(other_recorder, "other", "test");
+  }
+  other_recorder->clear();
+  ASSERT_THAT(recorder->events().size(), Eq(1));
+  ASSERT_THAT(recorder->events()[0].name, Eq("own"));
+  ASSERT_THAT(other_recorder->events().size(), Eq(0));
+}
+
+TEST_F(ATraceRecorder, RecordsNestedSpans) {
+  {
+    TraceSpan outer(recorder, "outer", "test");
+    TraceSpan inner(recorder, "inner", "test");
+    inner.arg("pass", 3);
+  }
+
+  const std::vector<TraceRecorder::Event> events = recorder->events();
+  ASSERT_THAT(events.size(), Eq(2));
+  ASSERT_THAT(events[0].name, Eq("inner"));
+  ASSERT_THAT(events[0].args, Eq("\"pass\":3"));
+  ASSERT_THAT(events[1].name, Eq("outer"));
+  ASSERT_THAT(events[1].begin, Le(events[0].begin));
+  ASSERT_THAT(events[0].begin + events[0].duration,
+              Le(events[1].begin + events[1].duration));
+}
+
+TEST_F(ATraceRecorder, RecordsOneEventPerRestart) {
+  TraceSpan span(recorder, "batch", "test");
+  span.restart();
+  span.arg("algorithm", "pool").arg("improved", true);
+  span.end();
+  span.end();
+
+  const std::vector<TraceRecorder::Event> events = recorder->events();
+  ASSERT_THAT(events.size(), Eq(2));
+  ASSERT_THAT(events[1].args, Eq("\"algorithm\":\"pool\",\"improved\":true"));
+}
+
+TEST_F(ATraceRecorder, DistinguishesThreads) {
+  {
+    TraceSpan span(recorder, "main", "test");
+  }
+  std::thread thread([&]() {
+      TraceSpan span(recorder, "worker", "test");
+    });
+  thread.join();
+
+  const std::vector<TraceRecorder::Event> events = recorder->events();
+  ASSERT_THAT(events.size(), Eq(2));
+  ASSERT_THAT(events[0].thread, Ne(events[1].thread));
+}
+
+TEST_F(ATraceRecorder, WritesChromeTraceFormat) {
+  {
+    TraceSpan span(recorder, "coarsening", "multilevel");
+  }
+  std::ostringstream out;
+  recorder->writeChromeTrace(out);
+  ASSERT_THAT(out.str(), HasSubstr("{\"displayTimeUnit\":\"ms\",\"traceEvents\":["));
+  ASSERT_THAT(out.str(), HasSubstr("{\"name\":\"coarsening\",\"cat\":\"multilevel\",\"ph\":\"X\""));
+}
+
+TEST_F(ATraceRecorder, EscapesStringsInChromeTraceFormat) {
+  {
+    TraceSpan span(recorder, "coarsening", "multilevel");
+    span.arg("file", "a \"b\"\\c\n");
+  }
+  std::ostringstream out;
+  recorder->writeChromeTrace(out);
+  ASSERT_THAT(out.str(), HasSubstr("\"args\":{\"file\":\"a \\\"b\\\"\\\\c\\n\"}"));
+}
+}  // namespace kahypar